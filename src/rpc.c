@@ -11,6 +11,8 @@
 *       - Generate complete GitHub project, ready to upload
 *       - Generate preconfigured GitHub Actions, ready to run
 *       - Command-line support for automated project generation
+*       - Parallel project files generation using worker threads
+*       - Assets staging by file links (hardlink/symlink) instead of copies
 *       - WEB: Download generated template as a .zip file
 *
 *   LIMITATIONS:
@@ -144,11 +146,45 @@
 #include "rpconfig.h"                // Data types and functionality (shared by [rpc] and [rpb] tools)
 
 // Standard C libraries
-#include <stdlib.h>                         // Required for: NULL, malloc(), free()
+#include <stdlib.h>                         // Required for: NULL, malloc(), free(), qsort()
 #include <stdio.h>                          // Required for: fopen(), fclose(), fread()...
 #include <string.h>                         // Required for: memcpy()
+#include <stdarg.h>                         // Required for: va_list, va_start(), va_arg(), va_end()
 #include <time.h>                           // Required for: time(), localtime()
 
+// Worker threads support, used on project generation
+// NOTE: Web platform runs jobs serially, no threads support required
+#if !defined(PLATFORM_WEB) && !defined(_WIN32)
+    #include <pthread.h>                    // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+    #include <unistd.h>                     // Required for: sysconf()
+#endif
+
+// Kernel-side file copy support, used on project generation
+#if !defined(PLATFORM_WEB) && defined(__linux__)
+    #include <fcntl.h>                      // Required for: open(), O_RDONLY, O_WRONLY...
+    #include <sys/stat.h>                   // Required for: fstat()
+    #include <sys/ioctl.h>                  // Required for: ioctl()
+    #include <sys/sendfile.h>               // Required for: sendfile()
+    #include <sys/syscall.h>                // Required for: SYS_copy_file_range
+    #if !defined(FICLONE)
+        #define FICLONE _IOW(0x94, 9, int)  // Reflink clone request, from linux/fs.h
+    #endif
+#elif !defined(PLATFORM_WEB) && defined(__APPLE__)
+    #include <copyfile.h>                   // Required for: copyfile()
+#endif
+
+// File mapping support, used on template package attached to executable
+#if !defined(PLATFORM_WEB) && !defined(_WIN32)
+    #include <sys/mman.h>                   // Required for: mmap(), munmap()
+    #include <unistd.h>                     // Required for: sysconf()
+#endif
+
+// File links support, used on assets staging
+#if !defined(PLATFORM_WEB) && !defined(_WIN32)
+    #include <sys/stat.h>                   // Required for: stat(), lstat(), mkdir()
+    #include <errno.h>                      // Required for: errno, EXDEV, EEXIST
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -157,6 +193,44 @@
 bool __stdcall FreeConsole(void);           // Close console from code (kernel32.lib)
 #endif
 
+// Worker threads platform types and functions
+// NOTE: Win32 functions declared manually to avoid including windows.h (conflicts with raylib)
+#if defined(PLATFORM_WEB)
+    #define RPC_NO_THREADS                  // Jobs processed serially on main thread
+#elif defined(_WIN32)
+typedef struct { void *ptr; } rpcMutex;     // Equivalent to SRWLOCK
+typedef struct { void *ptr; } rpcCondition; // Equivalent to CONDITION_VARIABLE
+typedef void *rpcThread;                    // Equivalent to HANDLE
+
+void __stdcall InitializeSRWLock(rpcMutex *lock);
+void __stdcall AcquireSRWLockExclusive(rpcMutex *lock);
+void __stdcall ReleaseSRWLockExclusive(rpcMutex *lock);
+void __stdcall InitializeConditionVariable(rpcCondition *cond);
+int __stdcall SleepConditionVariableSRW(rpcCondition *cond, rpcMutex *lock, unsigned long ms, unsigned long flags);
+void __stdcall WakeAllConditionVariable(rpcCondition *cond);
+void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *func)(void *), void *param, unsigned long flags, unsigned long *threadId);
+unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long ms);
+int __stdcall CloseHandle(void *handle);
+unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+int __stdcall CopyFileA(const char *existingFileName, const char *newFileName, int failIfExists);
+int __stdcall CreateHardLinkA(const char *fileName, const char *existingFileName, void *securityAttributes);
+unsigned char __stdcall CreateSymbolicLinkA(const char *symlinkFileName, const char *targetFileName, unsigned long flags);
+int __stdcall CreateDirectoryA(const char *pathName, void *securityAttributes);
+int __stdcall RemoveDirectoryA(const char *pathName);
+void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *securityAttributes, unsigned long creationDisposition, unsigned long flags, void *templateFile);
+void *__stdcall CreateFileMappingA(void *file, void *attributes, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char *name);
+void *__stdcall MapViewOfFile(void *fileMapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+int __stdcall UnmapViewOfFile(const void *baseAddress);
+unsigned long __stdcall GetFullPathNameA(const char *fileName, unsigned long bufferLength, char *buffer, char **filePart);
+unsigned long __stdcall GetLastError(void);
+int __stdcall QueryPerformanceCounter(long long *count);
+int __stdcall QueryPerformanceFrequency(long long *frequency);
+#else
+typedef pthread_mutex_t rpcMutex;
+typedef pthread_cond_t rpcCondition;
+typedef pthread_t rpcThread;
+#endif
+
 // Simple log system to avoid printf() calls if required
 // NOTE: Avoiding those calls, also avoids const strings memory usage
 #define SUPPORT_LOG_INFO
@@ -173,6 +247,28 @@ bool __stdcall FreeConsole(void);           // Close console from code (kernel32
 #define RPC_SOURCE_PATH_LENGTH      256     // Source file path length
 #define RPC_ASSET_PATH_LENGTH       256     // Asset file path length
 
+#define RPC_MAX_WORKER_THREADS       64     // Max worker threads for project generation
+#define RPC_MANIFEST_FILENAME   ".rpc-manifest" // Generation manifest file, saved in project output directory
+#define RPC_COPY_CHUNK_SIZE       65536     // File copy buffer size, used if no kernel-side copy is available
+#define RPC_MAX_GEN_SECTIONS         32     // Max project generation plan sections, used for profiling
+#define RPC_GEN_ARENA_BLOCK_SIZE  65536     // Generation memory arena block size, bigger allocations get a dedicated block
+#define RPC_MAX_LINKED_ASSETS      1024     // Max linked asset files resolved per project generation, including input assets
+#define RPC_MAX_LINKED_DEPTH         16     // Max linked asset files resolution depth (asset linking an asset linking...)
+#define RPC_MAX_PATH_LENGTH        1024     // Generation paths max length, including null terminator
+#define RPC_MAX_BATCH_COLUMNS        64     // Max batch manifest CSV columns
+#define RPC_MAX_TEMPLATE_PATTERNS    64     // Max replacement patterns per template patterns table
+#define RPC_MAX_COMPILED_TEMPLATES  128     // Max precompiled templates saved (template file and patterns table pairs)
+#define RPC_PACK_VERSION              3     // Template package format version
+#define RPC_PACK_DICTIONARY_SIZE  16384     // Template package preset dictionary max size, shared by text files (max 32KB, deflate window)
+#define RPC_PACK_DICTIONARY_SAMPLE 1024     // Template package preset dictionary sample size, taken from every text file start
+#define RPC_SCAN_CACHE_FILENAME "rpc.scan"  // Source files scan cache file, saved in application directory
+#define RPC_SCAN_CACHE_VERSION        2     // Source files scan cache file format version
+#define RPC_MAX_SCAN_CACHE_ENTRIES 4096     // Source files scan cache max entries, least recently used entries evicted
+#define RPC_MAX_SCAN_CACHE_SIZE 4194304     // Source files scan cache file max size (bytes), least recently used entries evicted
+#if !defined(RPC_PACK_COMPRESSION_LEVEL)
+    #define RPC_PACK_COMPRESSION_LEVEL    9     // Template package compression level: 0 (store) to 10 (best, slow)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -191,16 +287,534 @@ typedef struct rpcProjectInput {
 
     bool *srcFileSelected;          // Flags for selection toggle on src file list
     bool *assetFileSelected;        // Flags for selection toggle on asset file list
+
+    int *assetLookup;               // Assets paths lookup table, slots indexed by path hash -> RPC_MAX_ASSET_FILES*2
+    int assetLookupCount;           // Assets paths in lookup table, rebuilt if not matching assets count (-1 = invalidated)
 } rpcProjectInput;
 
 // Packed file entry
 // NOTE: Used for template packing to be attached to executable
 typedef struct PackFileEntry {
+    unsigned int offset;            // Package entry file compressed data offset, from package start
     int fileSize;                   // Package entry file uncompressed size
     int compFileSize;               // Package entry file compressed size
-    char filePath[256];             // Package entry file path and name
+    unsigned int crc32;             // Package entry file uncompressed data CRC32
+    unsigned int flags;             // Package entry flags: PackFileFlags
+    char filePath[256];             // Package entry file path and name, relative to packed directory
 } PackFileEntry;
 
+// Packed file entry flags
+typedef enum {
+    PACK_FILE_DICTIONARY = 1,       // File data compressed using package preset dictionary
+} PackFileFlags;
+
+// Package footer, placed at the end of package data
+// NOTE: Package layout: [files compressed data][dictionary compressed data][entries][lookup table][footer],
+// footer ends with package fourcc, so package can be found at the end of a file (i.e. executable)
+typedef struct PackFooter {
+    unsigned int dictOffset;        // Package preset dictionary compressed data offset, from package start
+    int dictSize;                   // Package preset dictionary size (0 = no dictionary)
+    int dictCompSize;               // Package preset dictionary compressed size
+    unsigned int entriesOffset;     // Package entries offset, from package start
+    int entryCount;                 // Package entries count
+    unsigned int lookupOffset;      // Package lookup table offset, from package start
+    int lookupSize;                 // Package lookup table size (power of two), entries indices by file path hash (-1 = empty slot)
+    unsigned int packSize;          // Package full size, including footer
+    int version;                    // Package format version: RPC_PACK_VERSION
+    char fourcc[4];                 // Package fourcc: rpch
+} PackFooter;
+
+// Package writer
+// NOTE: Files are compressed and appended on package data buffer, growing as required
+typedef struct PackWriter {
+    unsigned char *data;            // Package data
+    unsigned int size;              // Package data size
+    unsigned int capacity;          // Package data buffer capacity
+    PackFileEntry *entries;         // Package entries
+    int entryCount;                 // Package entries count
+    int entryCapacity;              // Package entries array capacity
+    unsigned int dictOffset;        // Package preset dictionary compressed data offset
+    int dictSize;                   // Package preset dictionary size (0 = no dictionary)
+    int dictCompSize;               // Package preset dictionary compressed size
+} PackWriter;
+
+// Package file compression task, processed on worker threads
+typedef struct PackTask {
+    const char *srcPath;            // Source file path
+    char filePath[256];             // File path in package, relative to packed directory
+    int level;                      // Compression level
+    unsigned char *fileData;        // File data
+    int fileSize;                   // File size
+    bool text;                      // File is text (no null bytes), preset dictionary can be used
+    const unsigned char *dictData;  // Package preset dictionary data (NULL if not available)
+    int dictSize;                   // Package preset dictionary size
+    unsigned char *compFileData;    // Compressed file data (NULL if not compressed)
+    int compFileSize;               // Compressed file size
+    unsigned int crc32;             // File data CRC32
+    unsigned int flags;             // Package entry flags: PackFileFlags
+    double time;                    // Compression time (microseconds)
+} PackTask;
+
+// Package data, loaded from memory
+// NOTE: Entries and lookup table point to package data, no copies
+typedef struct PackData {
+    const unsigned char *data;      // Package data (package start)
+    unsigned int size;              // Package data size
+    const PackFileEntry *entries;   // Package entries
+    int entryCount;                 // Package entries count
+    const int *lookup;              // Package lookup table, entries indices by file path hash (-1 = empty slot)
+    int lookupSize;                 // Package lookup table size (power of two)
+    unsigned char *dictData;        // Package preset dictionary, decompressed on package loading (NULL if not available)
+    int dictSize;                   // Package preset dictionary size
+} PackData;
+
+// Package file, package found at the end of a file (i.e. executable)
+// NOTE: Package region is mapped read-only, package data is read into memory if mapping not available
+typedef struct PackFile {
+    PackData pack;                  // Package data, pointing to mapped region (or read data)
+    void *mapData;                  // Mapped file region, starting at page boundary (NULL if not mapped)
+    size_t mapSize;                 // Mapped file region size
+    unsigned char *readData;        // Package data read into memory, if not mapped
+} PackFile;
+
+// Template files provider type
+typedef enum {
+    TEMPLATE_PROVIDER_DIRECTORY = 0, // Template files loaded from template directory
+    TEMPLATE_PROVIDER_PACK,         // Template files decompressed from template package attached to executable
+    TEMPLATE_PROVIDER_ZIP,          // Template files extracted from template zip archive (memory or file)
+} TemplateProviderType;
+
+// Template files provider
+// NOTE: Template files available on disk take precedence over archive (package or zip) files,
+// archive entries are accessed by index, looked up by file path relative to template directory
+typedef struct TemplateProvider {
+    int type;                       // Provider type: TemplateProviderType
+    PackFile pack;                  // PACK: Template package, mapped from executable
+    mz_zip_archive *zip;            // ZIP: Template zip archive reader, central directory loaded (sorted by file path)
+    unsigned char *zipData;         // ZIP: Template zip archive data, if loaded from file (NULL if provided from memory)
+    char zipRootPath[16];           // ZIP: Template files root path in archive: "" or "template/"
+} TemplateProvider;
+
+// Template zip archive file extraction output, file data written as decompressed
+typedef struct ZipExtractOutput {
+    FILE *file;                     // Output file
+    unsigned long long hash;        // Output data hash (FNV-1a 64bit), computed by chunks
+    unsigned long long size;        // Output data size written, chunks must be written sequentially
+} ZipExtractOutput;
+
+// Text replacement entry
+// NOTE: Used for multi-pattern text substitution on template files
+typedef struct TextReplacement {
+    const char *pattern;            // Text pattern to be found
+    const char *replacement;        // Text to replace pattern with
+} TextReplacement;
+
+// Path builder, paths are built appending components to a root path, no text formatting
+// NOTE: Builder is caller-owned, multiple paths can be built from same root
+typedef struct PathBuilder {
+    char path[RPC_MAX_PATH_LENGTH]; // Path text: root path and appended components
+    int rootLength;                 // Root path length
+    int length;                     // Path length
+} PathBuilder;
+
+// Text template span
+// NOTE: Template text is compiled into literal text ranges and pattern slots
+typedef struct TemplateSpan {
+    int offset;                     // Span text offset
+    int length;                     // Span text length (pattern length for slots)
+    int slot;                       // Span pattern index in replacements table (-1 for literal text)
+} TemplateSpan;
+
+// Precompiled template file
+// NOTE: Compiled at build time for one replacements patterns table (make templates),
+// only used if template file text is the one compiled (size and hash)
+typedef struct CompiledTemplate {
+    const char *key;                // Template file path, relative to template directory
+    int size;                       // Template file text size
+    unsigned long long hash;        // Template file text hash (FNV-1a 64bit)
+    int patternCount;               // Replacements patterns count
+    const char **patterns;          // Replacements patterns, in table order
+    int spanCount;                  // Template spans count
+    const TemplateSpan *spans;      // Template spans: literal text ranges and pattern slots
+} CompiledTemplate;
+
+// Text patterns matcher, built once per replacements patterns table
+// NOTE: Patterns overlaps are checked once, non-overlapping patterns tables are matched in a single text scan
+typedef struct TextMatcher {
+    int count;                      // Patterns count
+    char **patterns;                // Patterns, in table order
+    int *lengths;                   // Patterns lengths (0 for empty patterns, never matched)
+    bool overlapping;               // Patterns occurrences can overlap, patterns are matched one by one
+    unsigned long long hash;        // Patterns table hash (FNV-1a 64bit), matchers cache key
+} TextMatcher;
+
+// Text matchers cache
+// NOTE: Process-wide, matchers are shared by all template files and projects using same patterns table
+typedef struct TextMatcherCache {
+    TextMatcher **matchers;         // Text matchers built
+    int count;                      // Text matchers count
+    int capacity;                   // Text matchers array capacity
+} TextMatcherCache;
+
+// Worker task callback, index is the task index in current batch
+typedef void (*WorkerTaskCallback)(void *userData, int index);
+
+// Worker threads pool
+// NOTE: Tasks batch is processed in order by available threads, completion can be waited per task
+typedef struct WorkerPool {
+    int threadCount;                // Pool threads count (0 = tasks processed serially on caller thread)
+#if !defined(RPC_NO_THREADS)
+    rpcThread *threads;             // Pool threads
+    rpcMutex mutex;                 // Pool state access mutex
+    rpcCondition taskAvailable;     // Condition signaled when new tasks are available or pool is closing
+    rpcCondition taskCompleted;     // Condition signaled on every task completion
+#endif
+    bool closing;                   // Pool closing request, threads exit
+
+    WorkerTaskCallback callback;    // Current batch: task callback
+    void *userData;                 // Current batch: user data provided to callback
+    int taskCount;                  // Current batch: tasks count
+    int nextTask;                   // Current batch: next task to be processed
+    int completedCount;             // Current batch: tasks completed count
+    unsigned char *taskDone;        // Current batch: tasks completion flags
+    unsigned char *taskThread;      // Current batch: tasks processing thread (0 = caller thread, pool threads from 1)
+    int threadStarted;              // Pool threads started count, used to assign threads indices
+} WorkerPool;
+
+// Memory arena block
+typedef struct MemArenaBlock {
+    unsigned char *data;            // Block data
+    size_t size;                    // Block size
+    size_t used;                    // Block bytes used
+} MemArenaBlock;
+
+// Memory arena, bump allocator: allocations are not freed individually,
+// all of them are released at once on arena reset or unload
+// NOTE: Arena blocks are kept on reset, reused by next allocations
+typedef struct MemArena {
+    MemArenaBlock *blocks;          // Arena blocks
+    int blockCount;                 // Arena blocks count
+    int currentBlock;               // Current block, allocations are bumped from it
+    size_t blockSize;               // Arena default block size
+#if !defined(RPC_NO_THREADS)
+    rpcMutex mutex;                 // Arena access mutex, allocations can be requested by worker threads
+#endif
+    size_t size;                    // Bytes allocated since last reset (including alignment)
+    size_t peakSize;                // Peak bytes allocated, kept on reset
+    int allocCount;                 // Allocations count since last reset
+    int totalAllocCount;            // Allocations count since arena load
+} MemArena;
+
+// Project generation job type
+// NOTE: File output job types are consecutive, starting from GEN_JOB_COPY
+typedef enum {
+    GEN_JOB_LOG = 0,                // Log message only, no file operation
+    GEN_JOB_MKDIR,                  // Create output directory (full path for directories tree roots)
+    GEN_JOB_WRITE,                  // Write project configuration file (.rpc), processed on main thread
+    GEN_JOB_COPY,                   // Copy file
+    GEN_JOB_RENDER,                 // Load template text file, replace text patterns and save
+    GEN_JOB_LINK,                   // Hardlink file, symlink if crossing file systems (copy on failure)
+    GEN_JOB_SYMLINK,                // Symlink file (copy on failure)
+} GenJobType;
+
+// Project generation manifest entry
+// NOTE: Registers one generated output file and the source it was generated from
+typedef struct GenManifestEntry {
+    int type;                       // Generation job type: GEN_JOB_COPY, GEN_JOB_RENDER, GEN_JOB_LINK, GEN_JOB_SYMLINK
+    unsigned long long hash;        // Output data hash (FNV-1a 64bit), 0 for linked files
+    int srcSize;                    // Source file size
+    long srcModTime;                // Source file modification time
+    int outSize;                    // Output file size
+    long outModTime;                // Output file modification time
+    char *outPath;                  // Output file path, relative to project output directory
+    char *srcPath;                  // Source file path
+} GenManifestEntry;
+
+// Project generation manifest
+// NOTE: Loaded from previous generation to skip outputs already up to date
+typedef struct GenManifest {
+    GenManifestEntry *entries;      // Manifest entries
+    int count;                      // Manifest entries count
+    int *lookup;                    // Entries lookup table by output path hash (-1 = empty slot)
+    int lookupSize;                 // Entries lookup table size (power of two)
+} GenManifest;
+
+// Template file, loaded in template cache
+// NOTE: Shared by cache and generation jobs, released on main thread only
+typedef struct TemplateFile {
+    char *key;                      // Template file path, relative to template directory
+    char *text;                     // Template file text
+    int size;                       // Template file size
+    unsigned long long hash;        // Template file text hash (FNV-1a 64bit), used to validate precompiled templates
+    long modTime;                   // Template file modification time, when loaded (0 if loaded from template archive)
+    int refCount;                   // References count: template cache and generation jobs
+} TemplateFile;
+
+// Template cache
+// NOTE: Process-wide, template files are loaded once and reloaded if modified,
+// shared by all project generations (GUI and command line)
+typedef struct TemplateCache {
+    char rootPath[512];             // Template directory path, cache is cleared if changed
+    TemplateFile **files;           // Template files loaded
+    int count;                      // Template files count
+    int capacity;                   // Template files array capacity
+    rini_data configData;           // Project configuration template (.rpc), parsed with comments
+    long configModTime;             // Project configuration template modification time, when loaded
+    int configSize;                 // Project configuration template size, when loaded
+    int archiveLoadCount;           // Template files extracted from template archive (package or zip)
+    int archiveLoadSize;            // Template files data extracted from template archive (bytes)
+} TemplateCache;
+
+// Project generation job
+// NOTE: All job data is allocated from plan memory arena, jobs can be processed on worker threads
+typedef struct GenJob {
+    int type;                       // Job type: GenJobType
+    char *srcPath;                  // Job source file path: COPY, RENDER, LINK, SYMLINK
+    char *dstPath;                  // Job destination file/directory path: MKDIR, COPY, RENDER, LINK, SYMLINK
+    const char **replacements;      // Job replacement texts, resolved against following table patterns: RENDER
+    TemplateFile *templateFile;     // Job template file from template cache: RENDER (NULL if not available)
+    int archiveIndex;               // Job source file entry index in template archive: COPY (-1 if source file on disk)
+    const TextMatcher *matcher;     // Job text matcher for replacements patterns table: RENDER
+    const CompiledTemplate *compiled; // Job precompiled template matching template file and replacements: RENDER (NULL if none)
+    MemArena *arena;                // Job data memory arena, rendered text is also allocated from it
+    int replacementCount;           // Job replacement texts count
+    char *log;                      // Job log message, printed on job completion
+
+    int dependency;                 // Plan: directory job index required before this job (-1 if none)
+    int size;                       // Plan: estimated output size in bytes (0 for links)
+
+    const GenManifestEntry *prevEntry; // Previous generation manifest entry for destination (NULL if none)
+    unsigned long long hash;        // Output data hash (FNV-1a 64bit), 0 for linked files
+    int srcSize;                    // Source file size
+    long srcModTime;                // Source file modification time
+    int outSize;                    // Output file size, after generation
+    long outModTime;                // Output file modification time, after generation
+
+    int section;                    // Plan: generation section index, used for profiling
+    double startTime;               // Profiling: job processing start time (microseconds)
+    double endTime;                 // Profiling: job processing end time (microseconds)
+
+    bool skipped;                   // Job output was up to date, not written
+    bool failed;                    // Job failed to complete
+    bool linkFailed;                // Job link could not be created, file copied instead (job type changed to COPY)
+} GenJob;
+
+// Project generation jobs list
+typedef struct GenJobList {
+    GenJob *jobs;                   // Jobs array
+    int count;                      // Jobs count
+    int capacity;                   // Jobs array capacity
+    MemArena *arena;                // Jobs data memory arena (plan arena)
+} GenJobList;
+
+// Project generation jobs lists batch
+// NOTE: Multiple jobs lists (multiple projects) processed as a single worker tasks batch
+typedef struct GenJobBatch {
+    GenJobList **lists;             // Jobs lists
+    int count;                      // Jobs lists count
+} GenJobBatch;
+
+// Project generation output directory node
+// NOTE: Nodes match plan directory jobs by index, directory job path is the node full path
+typedef struct GenDirNode {
+    int parent;                     // Parent directory node index (-1 for tree roots)
+    int firstChild;                 // First subdirectory node index (-1 if none)
+    int nextSibling;                // Next sibling directory node index (-1 if none)
+    int nameOffset;                 // Directory name offset in directory job path (0 for tree roots)
+} GenDirNode;
+
+// Project generation output directories tree
+// NOTE: Generation-scoped, every output directory is planned once and created after its parent,
+// tree roots are created with full path, subdirectories with a single mkdir call
+typedef struct GenDirTree {
+    GenDirNode *nodes;              // Directory nodes, one per plan directory job
+    int count;                      // Directory nodes count
+    int capacity;                   // Directory nodes array capacity
+} GenDirTree;
+
+// Project generation plan
+// NOTE: All operations required to generate a project, planned before any output is written,
+// processing order: directories jobs, project configuration write job, files jobs
+typedef struct GenPlan {
+    bool valid;                     // Plan generated successfully (template available)
+    MemArena *arena;                // Plan memory arena, all plan temporaries and jobs data
+    bool arenaOwned;                // Plan memory arena loaded by plan, unloaded with it (reset otherwise)
+    char projectName[256];          // Project internal name
+    char projectOutPath[RPC_MAX_PATH_LENGTH]; // Project output directory path
+    GenJobList dirJobs;             // Directories creation jobs, parent-first order (depend on parent directory job)
+    GenDirTree dirTree;             // Directories tree, matching directories jobs
+    GenJob configJob;               // Project configuration file (.rpc) write job
+    rini_data configData;           // Project configuration data to be written
+    GenJobList fileJobs;            // Files generation jobs (depend on directories jobs)
+
+    const char *sections[RPC_MAX_GEN_SECTIONS]; // Generation sections names (static text)
+    int sectionCount;               // Generation sections count
+    int sectionDirStart;            // Current section first directory job index
+    int sectionFileStart;           // Current section first file job index
+    int sectionEvent;               // Current section planning profile event index
+} GenPlan;
+
+// Linked asset file, resources required by asset file: .fnt pages, .gltf uris, .obj mtllib, .mtl maps
+typedef struct LinkedAssetFile {
+    char *links;                    // Linked resources paths, relative to asset file directory, consecutive null-terminated strings
+    int linkCount;                  // Linked resources paths count
+    bool resolving;                 // Asset file linked resources being resolved (on current resolution path)
+} LinkedAssetFile;
+
+// Linked assets resolver, linked resources resolved recursively on project generation
+// NOTE: Generation-scoped, every asset file is parsed once (memoized by source path) and every
+// destination file is planned once (shared resources), resolver texts are allocated from plan arena
+typedef struct LinkedAssetResolver {
+    MemArena *arena;                // Resolver texts memory arena (plan arena)
+    char **filePaths;               // Asset files parsed, source paths -> RPC_MAX_LINKED_ASSETS
+    LinkedAssetFile *files;         // Asset files parsed, linked resources -> RPC_MAX_LINKED_ASSETS
+    int *fileLookup;                // Asset files lookup table, slots indexed by source path hash -> RPC_MAX_LINKED_ASSETS*2
+    int fileCount;                  // Asset files parsed count
+    char **dstPaths;                // Destination files planned, relative to assets path -> RPC_MAX_LINKED_ASSETS
+    char **dstSrcPaths;             // Destination files planned, source paths -> RPC_MAX_LINKED_ASSETS
+    int *dstLookup;                 // Destination files lookup table, slots indexed by path hash -> RPC_MAX_LINKED_ASSETS*2
+    int dstCount;                   // Destination files planned count
+    int linkedCount;                // Linked resources planned count
+    long long bytesRead;            // Asset files data parsed (bytes)
+} LinkedAssetResolver;
+
+// Profile event, saved as Chrome trace_event complete event ("X")
+typedef struct ProfileEvent {
+    char name[128];                 // Event name
+    const char *category;           // Event category (static text)
+    int threadId;                   // Event thread (0 = main thread, worker threads from 1)
+    double startTime;               // Event start time (microseconds)
+    double duration;                // Event duration (microseconds)
+    long long bytesRead;            // Event bytes read
+    long long bytesWritten;         // Event bytes written
+} ProfileEvent;
+
+// Profiler data
+// NOTE: Events are only recorded on main thread, jobs processed on worker threads register their
+// times on job data and events are added after jobs completion
+typedef struct Profiler {
+    bool enabled;                   // Profiling enabled
+    double baseTime;                // Clock time at profiler initialization (microseconds)
+    ProfileEvent *events;           // Recorded events
+    int count;                      // Recorded events count
+    int capacity;                   // Recorded events array capacity
+} Profiler;
+
+// Source code function asset usage, string literals classified by enclosing call
+typedef enum {
+    SOURCE_USAGE_UNKNOWN = 0,       // Function not known, enclosing call usage applies
+    SOURCE_USAGE_LOAD,              // Asset loading function, string literals are asset paths
+    SOURCE_USAGE_SAVE,              // File saving function, string literals are output paths
+    SOURCE_USAGE_TEXT,              // Text function, string literals are not paths (formats, messages)
+} SourceUsage;
+
+// Asset file kind, by file extension
+// NOTE: Kinds after ASSET_KIND_CODE are project assets
+typedef enum {
+    ASSET_KIND_NONE = 0,            // File extension not supported
+    ASSET_KIND_CODE,                // Source code file: .c, .h
+    ASSET_KIND_IMAGE,               // Image file: .png, .bmp, .jpg, .qoi, .gif, .raw, .hdr, .ktx, .dxt, .astc, .pvr
+    ASSET_KIND_FONT,                // Font file: .ttf, .otf, .fnt
+    ASSET_KIND_AUDIO,               // Audio file: .wav, .ogg, .mp3, .flac, .mod, .xm, .qoa
+    ASSET_KIND_MODEL,               // Model file: .obj, .iqm, .glb, .gltf, .m3d, .vox
+    ASSET_KIND_SHADER,              // Shader file: .vs, .fs
+    ASSET_KIND_TEXT,                // Text file: .txt
+} AssetKind;
+
+// Asset file extension, lookup table entry
+typedef struct AssetExtension {
+    const char *ext;                // File extension, lowercase without '.'
+    int kind;                       // File kind: AssetKind
+} AssetExtension;
+
+// Source code function, known raylib/libc functions receiving string literals
+typedef struct SourceFunction {
+    const char *name;               // Function name
+    int usage;                      // Function asset usage: SourceUsage
+} SourceFunction;
+
+// Source file scanned for asset paths
+// NOTE: Scan cache entry is only read while scanning, source file scanned on worker threads
+typedef struct SourceScanFile {
+    char *path;                     // Source file path
+    int cacheIndex;                 // Scan cache entry index for source file path (-1 if not cached)
+    int size;                       // Source file size, when scanned
+    long modTime;                   // Source file modification time, when scanned
+    unsigned long long hash;        // Source file text hash (FNV-1a 64bit), cache entry hash if file not loaded
+    bool cached;                    // Asset paths reused from scan cache entry, no lexing required
+    char *assetPaths;               // Asset paths found, consecutive '\0' terminated strings (NULL if not scanned)
+    int assetPathsSize;             // Asset paths data size
+    int assetCount;                 // Asset paths count
+} SourceScanFile;
+
+// Source files assets scan, source files scanned on worker threads
+// NOTE: Scanned asset paths are merged into project input on main thread, in source files order
+typedef struct SourceScan {
+    WorkerPool *pool;               // Worker threads pool (NULL if no scan in progress)
+    SourceScanFile *files;          // Source files to scan
+    int fileCount;                  // Source files count
+    int fileCapacity;               // Source files array capacity
+} SourceScan;
+
+// Source files scan cache entry
+typedef struct ScanCacheEntry {
+    char *path;                     // Source file path
+    int size;                       // Source file size, when scanned
+    long modTime;                   // Source file modification time, when scanned
+    unsigned long long hash;        // Source file text hash (FNV-1a 64bit), when scanned
+    unsigned int lastUse;           // Entry last use stamp, least recently used entries evicted
+    char *assetPaths;               // Asset paths found, consecutive '\0' terminated strings
+    int assetPathsSize;             // Asset paths data size
+    int assetCount;                 // Asset paths count
+} ScanCacheEntry;
+
+// Source files scan cache, asset paths found per source file
+// NOTE: Process-wide, loaded from application directory on first scan and saved after every scan,
+// entries are looked up by source file path and reused if source file size and time (or text hash) match
+typedef struct ScanCache {
+    bool loaded;                    // Scan cache file loaded (or not available)
+    bool modified;                  // Scan cache modified since loaded or saved
+    ScanCacheEntry *entries;        // Scan cache entries
+    int count;                      // Scan cache entries count
+    int capacity;                   // Scan cache entries array capacity
+    int *lookup;                    // Entries lookup table by source file path hash (-1 = empty slot)
+    int lookupSize;                 // Entries lookup table size (power of two)
+    unsigned int useStamp;          // Last use stamp assigned to an entry
+} ScanCache;
+
+// Source files scan cache file header
+typedef struct ScanCacheHeader {
+    char fourcc[4];                 // File type: "rpcs"
+    int version;                    // File format version: RPC_SCAN_CACHE_VERSION
+    int entryCount;                 // Entries count, every entry record followed by path and asset paths
+    unsigned int useStamp;          // Last use stamp assigned to an entry
+} ScanCacheHeader;
+
+// Source files scan cache file entry record
+// NOTE: Record followed by source file path and asset paths data
+typedef struct ScanCacheRecord {
+    unsigned long long hash;        // Source file text hash (FNV-1a 64bit)
+    long long modTime;              // Source file modification time
+    unsigned int lastUse;           // Entry last use stamp
+    int size;                       // Source file size
+    int pathSize;                   // Source file path size, including '\0'
+    int assetPathsSize;             // Asset paths data size
+    int assetCount;                 // Asset paths count
+    int reserved;                   // Reserved, record size multiple of 8 bytes
+} ScanCacheRecord;
+
+// Batch generation manifest
+// NOTE: Projects defined by CSV rows or by project configuration files (.rpc) in a directory,
+// CSV header row defines columns: .rpc property keys and special columns TEMPLATE, INPUT, OUTPUT
+typedef struct BatchManifest {
+    int count;                      // Projects count
+    char *text;                     // CSV: File text, columns and cells point into it
+    int columnCount;                // CSV: Columns count
+    char **columns;                 // CSV: Columns names, from header row
+    char **cells;                   // CSV: Projects cells [count*columnCount], NULL if not defined
+    FilePathList configFiles;       // Directory: Project configuration files (.rpc)
+} BatchManifest;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -258,6 +872,21 @@ static rpcProjectInput input = { 0 };           // Project input data (requried
 
 static int selectedTemplate = 0;                // Project selected template, defines input data
 static char generationOutPath[256] = { 0 };     // Project generation output path
+static int generationThreadCount = 0;           // Project generation worker threads (0 = processors count)
+static Profiler profiler = { 0 };               // Project generation profiler (--profile)
+static TemplateCache templateCache = { 0 };     // Project generation template files cache
+static TemplateProvider templateProvider = { 0 }; // Project template files provider: directory, package attached to executable or zip archive
+static SourceScan sourceScan = { 0 };           // Project input source files assets scan (files and directories added)
+static ScanCache scanCache = { 0 };             // Source files scan cache, persistent between runs
+static TextMatcherCache textMatchers = { 0 };   // Text matchers, one per replacements patterns table
+
+// Precompiled template files, generated on building (make templates)
+#if defined(SUPPORT_COMPILED_TEMPLATES)
+    #include "rpc_templates.h"              // Precompiled templates: compiledTemplates[], compiledTemplateCount
+#else
+static const CompiledTemplate *compiledTemplates = NULL;
+static const int compiledTemplateCount = 0;
+#endif
 
 // TODO: Support icons images viewing
 static Texture2D *texProjectIcons = { 0 };      // Project icon textures
@@ -319,6 +948,17 @@ static bool windowExitActive = false;
 // Command line functionality
 static void ShowCommandLineInfo(void);                      // Show command line usage info
 static void ProcessCommandLine(int argc, char *argv[]);     // Process command line input
+static bool SaveCompiledTemplates(const char *fileName);    // Save precompiled template files as C header
+static void SaveCText(FILE *file, const char *text);        // Save text as C string literal, escaping required characters
+static void AddProjectInputPaths(rpcProjectInput *input, const char *paths, char delimiter); // Add project input files, directories are scanned
+static int SetProjectConfigProperty(rpcProjectConfig config, const char *key, const char *text); // Set project config property from text
+static void LogGenPlanDryRun(const GenPlan *plan);          // Log project generation plan summary, nothing written
+
+// Batch projects generation
+static BatchManifest LoadBatchManifest(const char *fileName); // Load batch manifest: CSV file or directory with .rpc files
+static void UnloadBatchManifest(BatchManifest *manifest);   // Unload batch manifest
+static int SplitCSVLine(char *line, char **fields, int maxFields); // Split CSV line into fields, line text is modified
+static void GenerateProjectBatch(rpcProjectConfig config, rpcProjectInput input, const char *manifestPath, int parallelCount, bool dryRun); // Generate all projects defined in batch manifest
 #endif
 
 static void UpdateDrawFrame(void);                          // Update and draw one frame
@@ -326,21 +966,174 @@ static void UpdateDrawFrame(void);                          // Update and draw o
 static rpcProjectInput rpcLoadProjectInput(void);           // Load project source/asset file paths bucket
 static void rpcUnloadProjectInput(rpcProjectInput input);   // Unload project source/asset file paths bucket
 static void rpcUpdateProjectInput(rpcProjectInput *input, int selTemplate); // Update input data by selected template
+static bool AddProjectInputAsset(rpcProjectInput *input, const char *assetPath); // Add asset file to project input, normalized path, duplicates omitted
+static int GetAssetFileKind(const char *fileName);          // Get asset file kind by file extension: AssetKind
 
 static char **LoadSourceAssetPaths(const char *filePath, int *assetPathCount); // Scan resource paths in example file
 static void UnloadSourceAssetPaths(char **assetPaths);      // Unload resource paths scanned
+static int GetSourceFunctionUsage(const char *name, int nameLength); // Get source function asset usage: SourceUsage
+static int AddSourceAssetPath(char **paths, int count, int *slots, const char *path); // Add asset path scanned, duplicates omitted (returns paths count)
+static int ScanSourceAssetPaths(const char *code, char **paths); // Scan asset paths from source code text, returns paths count (worker-safe)
+
+// Source files assets scan on worker threads
+static void AddSourceScanFile(SourceScan *scan, const char *filePath); // Add source file to assets scan, scanned when started
+static void StartSourceScan(SourceScan *scan);              // Start source files assets scan on worker threads (non-blocking)
+static void UpdateSourceScan(SourceScan *scan, rpcProjectInput *input); // Update source files assets scan, finished when all files scanned
+static void FinishSourceScan(SourceScan *scan, rpcProjectInput *input); // Finish source files assets scan, asset paths merged into project input
+static void ProcessSourceScanTask(void *userData, int index); // Process source file assets scan, worker task callback
+static void ScanSourceFile(SourceScanFile *file, const ScanCacheEntry *entry); // Scan source file asset paths, cache entry reused if file not changed (worker-safe)
+
+// Source files scan cache functions
+static void LoadScanCache(void);                            // Load source files scan cache from application directory (once)
+static void SaveScanCache(void);                            // Save source files scan cache if modified, least recently used entries evicted
+static void UnloadScanCache(void);                          // Unload source files scan cache
+static int GetScanCacheEntryIndex(const char *path);        // Get scan cache entry index for source file path (-1 if not found)
+static void SetScanCacheEntry(const SourceScanFile *file);  // Set scan cache entry from source file scanned, entry added if required
+static void BuildScanCacheLookup(void);                     // Build scan cache entries lookup table by source file path
+static int CompareScanCacheEntries(const void *a, const void *b); // Compare scan cache entries by last use, most recent first
 
 // Generate output project structure
 static void GenerateProject(rpcProjectConfig project, rpcProjectInput input, const char *outPath);
-
-// Packing and unpacking of template files (NOT USED)
-static char *PackDirectoryData(const char *baseDirPath, int *packSize);
-static void UnpackDirectoryData(const char *outputDirPath, const unsigned char *data, int *dataSize, PackFileEntry *entries, int fileCount);
-static char *LoadFileTextPack(const char *fileName, const unsigned char *packData, PackFileEntry *entries, int fileCount);
+static GenPlan LoadGenPlan(rpcProjectConfig project, rpcProjectInput input, const char *outPath, MemArena *arena); // Load project generation plan, nothing is written (arena NULL = plan arena)
+static void UnloadGenPlan(GenPlan *plan);                   // Unload project generation plan
+static void ExecuteGenPlan(GenPlan *plan);                  // Execute project generation plan, writing all outputs
+static void ExecuteGenPlans(GenPlan *plans, int count, WorkerPool *pool); // Execute multiple project generation plans, sharing worker threads
+static bool SaveGenPlanJSON(const GenPlan *plan, const char *fileName); // Save project generation plan as JSON
+static void SaveJSONText(FILE *file, const char *text);     // Save text as JSON string, escaping required characters
+
+// Packing and unpacking of template files
+static char *PackDirectoryData(const char *baseDirPath, int level, int *packSize);
+static void UnpackDirectoryData(const char *outputDirPath, const PackData *pack);
+static char *LoadFileTextPack(const char *fileName, const PackData *pack);
+static bool UnpackPackFile(const PackData *pack, int index, const char *filePath, unsigned long long *hash); // Unpack package file to output file, streamed decompression
+static void ProcessPackTask(void *userData, int index);     // Process package file compression task, worker task callback
+static unsigned char *CompressPackData(const unsigned char *data, int dataSize, const unsigned char *dictData, int dictSize, int level, int *compDataSize); // Compress package data (raw deflate), preset dictionary optional
+static unsigned char *LoadPackDictionary(const PackTask *tasks, int count, int *dictSize); // Load package preset dictionary, concatenating text files samples
+static bool AddPackFile(PackWriter *writer, const char *filePath, const unsigned char *compFileData, int compFileSize, int fileSize, unsigned int crc32, unsigned int flags); // Add file to package, data already compressed
+static void AddPackDictionary(PackWriter *writer, const unsigned char *dictData, int dictSize, int level); // Add preset dictionary to package, data is compressed
+static unsigned char *ExportPackData(PackWriter *writer, int *packSize); // Export package data, entries and lookup table appended (writer unloaded)
+static void AppendPackData(PackWriter *writer, const void *data, unsigned int size); // Append data to package, buffer grows as required
+#if defined(BUILD_TEMPLATE_INTO_EXE)
+static PackData LoadPackData(const unsigned char *data, int dataSize); // Load package from memory data, package found at the end of data
+static PackFile LoadPackFile(const char *fileName);         // Load package file, package found at the end of file is mapped read-only
+#endif
+static void UnloadPackData(PackData *pack);                 // Unload package data, preset dictionary released
+static int GetPackEntryIndex(const PackData *pack, const char *filePath); // Get package entry index for file path (-1 if not found)
+static void UnloadPackFile(PackFile *file);                 // Unload package file, mapped region released
 
 // Split string into multiple strings
 // NOTE: No memory is dynamically allocated
 static const char **GetSubtextPtrs(char *text, char delimiter, int *count);
+
+// Replace multiple text patterns in a single pass, equivalent to chained TextReplaceAlloc() calls
+// NOTE: Replacement texts must be resolved, precompiled template is used if provided, no patterns search required
+// WARNING: Returned text must be freed by user (RL_FREE)
+static char *TextReplaceTemplate(const char *text, const TextMatcher *matcher, const char **replacements, const CompiledTemplate *compiled, MemArena *arena);
+static const char **ResolveTextReplacements(const TextMatcher *matcher, const TextReplacement *replacements, MemArena *arena); // Resolve replacement texts against following table patterns
+static const TextMatcher *LoadTextMatcher(const char **patterns, int count); // Load text matcher for patterns table, built once and cached
+static void UnloadTextMatchers(void);                       // Unload text matchers cache
+static TemplateSpan *CompileTextTemplate(const TextMatcher *matcher, int firstPattern, const char *text, int *spanCount); // Compile text template: literal spans and pattern slots (RL_FREE)
+static char *RenderTextTemplate(const char *text, const TemplateSpan *spans, int spanCount, const char **replacements, int count, MemArena *arena); // Render text template spans (RL_FREE if no arena)
+static char *TextCopyAlloc(const char *text);               // Copy text into a new allocated buffer (RL_FREE)
+
+// Path builder functions
+static void SetPathRoot(PathBuilder *builder, const char *root, const char *subPath); // Set builder root path, sub path joined with '/' if provided
+static const char *BuildPath(PathBuilder *builder, const char *component, ...); // Build path from root, NULL-terminated components concatenated after '/'
+static void AppendPathText(PathBuilder *builder, const char *text); // Append text to builder path, truncated to RPC_MAX_PATH_LENGTH
+
+// Worker threads pool functions
+static WorkerPool *LoadWorkerPool(int threadCount);         // Load worker threads pool (0 = processors count)
+static void UnloadWorkerPool(WorkerPool *pool);             // Unload worker threads pool, waiting for current tasks
+static void RunWorkerTasks(WorkerPool *pool, WorkerTaskCallback callback, void *userData, int taskCount); // Start tasks batch (non-blocking)
+static void WaitWorkerTask(WorkerPool *pool, int index);    // Wait for one task of current batch to complete
+static void WaitWorkerTasks(WorkerPool *pool);              // Wait for all tasks of current batch to complete
+static int GetWorkerTasksCompleted(WorkerPool *pool);       // Get current batch tasks completed count
+static int GetProcessorCount(void);                         // Get available processors count
+
+// Memory arena functions
+static MemArena *LoadMemArena(size_t blockSize);            // Load memory arena, blocks allocated on demand
+static void UnloadMemArena(MemArena *arena);                // Unload memory arena, all allocations released
+static void ResetMemArena(MemArena *arena);                 // Reset memory arena, all allocations released (blocks kept)
+static void *MemArenaAlloc(MemArena *arena, size_t size);   // Allocate zero-initialized memory from arena
+static char *MemArenaCopyText(MemArena *arena, const char *text); // Copy text into arena memory (NULL if text is NULL)
+
+// Template cache functions
+static void SetTemplateCacheRoot(const char *rootPath);     // Set template cache directory, cache is cleared if changed
+static TemplateFile *LoadTemplateFile(const char *fileName); // Load template file from cache, reloaded if modified (reference added)
+static void UnloadTemplateFile(TemplateFile *file);         // Unload template file reference
+static rini_data LoadTemplateConfigData(const char *fileName); // Load project configuration template data (.rpc), copied from cache
+static void UnloadTemplateCache(void);                      // Unload template cache, all template files
+static rpcProjectConfig LoadTemplateProjectConfig(void);    // Load project configuration template (.rpc), from template archive if not available on disk
+static const char *GetTempFilePath(const char *fileName);   // Get temporary file path, in system temporary directory
+static const CompiledTemplate *GetCompiledTemplate(const TemplateFile *file, const TextReplacement *replacements, int count); // Get precompiled template for file and replacements
+
+// Template provider functions
+#if defined(BUILD_TEMPLATE_INTO_EXE)
+static bool LoadTemplateProviderPack(const char *fileName); // Load template provider from package attached to file (executable)
+#endif
+static bool LoadTemplateProviderZip(const unsigned char *data, int dataSize); // Load template provider from zip archive data, data must be kept while used
+static bool LoadTemplateProviderZipFile(const char *fileName); // Load template provider from zip archive file
+static void UnloadTemplateProvider(void);                   // Unload template provider, directory provider set
+static const char *GetTemplateArchivePath(const char *fileName); // Get template file path in template archive (NULL if not a template file)
+static int GetTemplateArchiveIndex(const char *fileName);   // Get template file entry index in template archive (-1 if not found)
+static int GetTemplateArchiveCount(void);                   // Get template archive entries count
+static bool GetTemplateArchiveInfo(int index, int *size, unsigned int *crc32); // Get template archive entry file size and CRC32
+static char *LoadTemplateArchiveText(int index);            // Load template archive entry file as text (null terminated)
+static bool ExtractTemplateArchiveFile(int index, const char *filePath, unsigned long long *hash); // Extract template archive entry to output file, streamed
+
+// Project generation jobs functions
+static int AddGenJob(GenJobList *list, int type, const char *srcPath, const char *dstPath, const char *log); // Add job to list, returns job index
+static void AddGenRenderJob(GenJobList *list, const char *srcPath, const char *dstPath, const TextReplacement *replacements, int count); // Add template render job
+static void UnloadGenJobs(GenJobList *list);                // Unload jobs list data
+static int AddGenDirectory(GenPlan *plan, const char *dirPath); // Add output directory to plan directories tree, returns directory job index
+static int AddGenDirectoryNode(GenPlan *plan, int parent, const char *dirPath, int length, int nameOffset); // Add directory node and job to plan directories tree
+static bool MakeDirectoryEntry(const char *dirPath);        // Create one directory, parent directory must exist
+static bool RemoveDirectoryEntry(const char *dirPath);      // Remove one directory, only removed if empty
+static void ProcessGenJob(void *userData, int index);       // Process one generation job (worker task callback)
+static bool IsGenOutputUnchanged(const GenManifestEntry *entry, const char *outPath); // Check output file unchanged since previous generation
+static GenJob *GetGenBatchJob(const GenJobBatch *batch, int index); // Get job from jobs lists batch
+static void RunGenJobs(GenJobList **lists, int count, WorkerPool *pool); // Process jobs lists as a single tasks batch, logging results in jobs order
+static void SetGenPlanDependencies(GenPlan *plan);          // Set plan jobs dependencies and estimated output sizes
+static void BeginGenPlanSection(GenPlan *plan, const char *name); // Begin plan section, next jobs added are assigned to it
+static void EndGenPlanSection(GenPlan *plan);               // End current plan section
+static void AddGenProfileEvents(const GenPlan *plan, const GenJobList *list, const unsigned char *taskThread); // Add processed jobs profile events
+static void AddGenSectionsProfileEvents(const GenPlan *plan); // Add plan sections profile events, including jobs bytes read/written
+static void GetGenJobBytes(const GenJob *job, long long *bytesRead, long long *bytesWritten); // Get job bytes read and written on processing
+
+// Linked assets resolution functions
+static LinkedAssetResolver LoadLinkedAssetResolver(MemArena *arena); // Load linked assets resolver, texts allocated from arena
+static void UnloadLinkedAssetResolver(LinkedAssetResolver *resolver); // Unload linked assets resolver
+static bool AddLinkedAssetDestination(LinkedAssetResolver *resolver, const char *dstPath, const char *srcPath); // Add destination file planned, relative to assets path (false if already planned)
+static int GetLinkedAssetFile(LinkedAssetResolver *resolver, const char *filePath); // Get asset file index, asset file parsed on first request (-1 if not available)
+static void AddGenLinkedAssets(GenPlan *plan, LinkedAssetResolver *resolver, PathBuilder *assetsRoot, const char *srcPath, const char *dstPath, int jobType, int depth); // Add asset file linked resources to plan, recursively
+static int ParseLinkedAssetPaths(const char *fileName, const char *text, char *links, int *linksSize); // Parse linked resources paths from asset file text, returns paths count
+static bool GetLinkedAssetPath(char *result, const char *filePath, const char *link); // Get linked resource path from linking file path, '.' and '..' resolved
+static int *GetPathLookupSlot(int *lookup, int lookupSize, char **paths, const char *path); // Get path lookup table slot, path index or -1 if not found
+
+// Profiling functions
+static void InitProfiler(void);                             // Initialize profiler, events recording enabled
+static void CloseProfiler(const char *fileName);            // Close profiler, saving recorded events (Chrome trace_event JSON)
+static double GetProfileTime(void);                         // Get time since profiler initialization (microseconds)
+static int BeginProfileEvent(const char *name, const char *category); // Begin profile event on main thread, returns event index (-1 if disabled)
+static void EndProfileEvent(int index, long long bytesRead, long long bytesWritten); // End profile event, registering bytes read/written
+static void AddProfileEvent(const char *name, const char *category, int threadId, double startTime, double endTime, long long bytesRead, long long bytesWritten); // Add complete profile event
+
+// Project generation manifest functions
+static GenManifest LoadGenManifest(const char *fileName);   // Load generation manifest file (.rpc-manifest)
+static void UnloadGenManifest(GenManifest *manifest);       // Unload generation manifest data
+static void SaveGenManifest(const GenJobList *list, const char *basePath, const char *fileName); // Save generation manifest from processed jobs
+static const GenManifestEntry *GetGenManifestEntry(const GenManifest *manifest, const char *outPath); // Get manifest entry for output path (relative)
+static void SetGenJobsManifest(GenJobList *list, const GenManifest *manifest, const char *basePath); // Link jobs to previous manifest entries
+static int RemoveGenStaleOutputs(const GenManifest *manifest, const GenJobList *dirList, const GenJobList *list, const char *basePath); // Remove previous outputs not generated anymore
+static unsigned long long ComputeHashFNV64(const unsigned char *data, int dataSize); // Compute data hash (FNV-1a 64bit)
+static unsigned long long UpdateHashFNV64(unsigned long long hash, const unsigned char *data, int dataSize); // Update data hash (FNV-1a 64bit), computed by chunks
+static unsigned long long ComputeFileHashFNV64(const char *fileName); // Compute file data hash (FNV-1a 64bit), read by chunks
+static bool CopyFileData(const char *srcPath, const char *dstPath, unsigned long long *hash); // Copy file data, kernel-side if possible
+static bool LinkFileData(const char *srcPath, const char *dstPath, bool symbolic); // Link file to source file, hardlink or symlink
+static bool IsFileLinked(const char *srcPath, const char *dstPath, bool symbolic); // Check if file is a link to source file
+static bool IsSameFile(const char *pathA, const char *pathB); // Check if both paths refer to the same file data
+static bool IsSameFilePath(const char *pathA, const char *pathB); // Check if both paths refer to the same file entry, not linked files
+static const char *GetGenRelativePath(const char *outPath, const char *basePath); // Get output path relative to project output directory
 //------------------------------------------------------------------------------------
 
 // Load/Save application configuration
@@ -371,32 +1164,39 @@ int main(int argc, char *argv[])
     //--------------------------------------------------------------------------------
 
 #if defined(BUILD_TEMPLATE_INTO_EXE)
-    // Attach template data into generated executable on first run
-    int exeFileDataSize = 0;
-    unsigned char *exeFileData = LoadFileData(argv[0], &exeFileDataSize);
-
-    // Check if template already added to not add it again
-    char fourcc[5] = { 0 };
-    memcpy(fourcc, exeFileData + exeFileDataSize - 4, 4);
-
-    if ((fourcc[0] != 'r') || (fourcc[1] != 'p') || (fourcc[2] != 'c') || (fourcc[3] != 'h'))
+    // Map template package attached to executable, only package footer is read
+    // NOTE: Executable data is not loaded, package entries are decompressed from mapped region
+    if (!LoadTemplateProviderPack(argv[0]))
     {
         // No template data attached to exe, so we attach it
         int packDataSize = 0;
-        char *packData = PackDirectoryData(TextFormat("%s/template", GetApplicationDirectory()), &packDataSize);
+        char *packData = PackDirectoryData(TextFormat("%s/template", GetApplicationDirectory()), RPC_PACK_COMPRESSION_LEVEL, &packDataSize);
 
-        int outExeFileDataSize = exeFileDataSize + packDataSize;
-        char *outExeFileData = (char *)RL_CALLOC(outExeFileDataSize, 1);
-        memcpy(outExeFileData, exeFileData, exeFileDataSize);
-        memcpy(outExeFileData + exeFileDataSize, packData, packDataSize);
+        // NOTE: Executable file is copied and package appended aligned to 8 bytes,
+        // package tables are used directly from mapped data
+        const char *outExeFileName = TextFormat("%s.template.exe", GetFileNameWithoutExt(argv[0]));
 
-        SaveFileData(TextFormat("%s.template.exe", GetFileNameWithoutExt(argv[0])), outExeFileData, outExeFileDataSize);
+        if ((packData != NULL) && CopyFileData(argv[0], outExeFileName, NULL))
+        {
+            static const char padding[8] = { 0 };
+            FILE *outExeFile = fopen(outExeFileName, "ab");
+
+            if (outExeFile != NULL)
+            {
+                fwrite(padding, 1, (8 - (GetFileLength(argv[0])%8))%8, outExeFile);
+                fwrite(packData, 1, packDataSize, outExeFile);
+                fclose(outExeFile);
+            }
+        }
 
-        RL_FREE(outExeFileData);
         RL_FREE(packData);
     }
 #endif
 
+    // Template zip archive used if template directory is not available
+    // NOTE: Web build can preload one compressed template.zip instead of all template directory files
+    if ((templateProvider.type == TEMPLATE_PROVIDER_DIRECTORY) && !DirectoryExists("template") && FileExists("template.zip")) LoadTemplateProviderZipFile("template.zip");
+
     // Get current year
     time_t now = time(NULL);
     struct tm *nowTime = localtime(&now);
@@ -407,6 +1207,7 @@ int main(int argc, char *argv[])
 #endif
 #if defined(COMMAND_LINE_ONLY)
     ProcessCommandLine(argc, argv);
+    UnloadTemplateProvider();
 #else
 
 #if defined(PLATFORM_DESKTOP)
@@ -427,7 +1228,7 @@ int main(int argc, char *argv[])
             {
                 // Process automatically the C file and setup a project using source file name
                 // WARNING: Really? Is this the desired behaviour?
-                project = rpcLoadProjectConfig("template/project_name.rpc"); // Load base template data
+                project = LoadTemplateProjectConfig(); // Load base template data
                 input = rpcLoadProjectInput();
 
                 rpcSetText(project, "PROJECT_INTERNAL_NAME", TextToSnake(GetFileNameWithoutExt(argv[1])));
@@ -444,13 +1245,12 @@ int main(int argc, char *argv[])
                 int assetCount = 0;
                 char **assetPaths = LoadSourceAssetPaths(argv[1], &assetCount);
 
-                for (int a = 0; (a < assetCount) && (input.assetFileCount < RPC_MAX_ASSET_FILES); a++)
+                for (int a = 0; a < assetCount; a++)
                 {
                     // WARNING: Not verifying at the moment if asset exist, just adding it to assets list
                     //const char *fullPath = TextFormat("%s/%s", GetDirectoryPath(multiFileList[i]), assetPaths[a]);
                     //if (FileExists(TextFormat(fullPath))) { }
-                    strcpy(input.assetFilePaths[input.assetFileCount], assetPaths[a]);
-                    input.assetFileCount++;
+                    AddProjectInputAsset(&input, assetPaths[a]);
                 }
 
                 UnloadSourceAssetPaths(assetPaths);
@@ -460,6 +1260,10 @@ int main(int argc, char *argv[])
 
                 rpcUnloadProjectInput(input);
                 rpcUnloadProjectConfig(project);
+                UnloadScanCache();
+                UnloadTemplateCache();
+                UnloadTextMatchers();
+                UnloadTemplateProvider();
 
                 return 0;
             }
@@ -467,6 +1271,7 @@ int main(int argc, char *argv[])
         else
         {
             ProcessCommandLine(argc, argv);
+            UnloadTemplateProvider();
             return 0;
         }
     }
@@ -497,7 +1302,7 @@ int main(int argc, char *argv[])
     {
         // Initialize project config (with default values)
         selectedTemplate = 1;   // Basic window
-        project = rpcLoadProjectConfig("template/project_name.rpc");
+        project = LoadTemplateProjectConfig();
 
         // Set default template input source file
         // NOTE: "project_name" would be renamed to PROJECT_INTERNAL_NAME on generation
@@ -588,7 +1393,12 @@ int main(int argc, char *argv[])
     //--------------------------------------------------------------------------------------
     //rpcUnloadProjectConfigTyped(project);
 
+    FinishSourceScan(&sourceScan, &input); // Finish source files assets scan (if in progress)
+    UnloadScanCache();           // Unload source files scan cache
     UnloadRenderTexture(target); // Unload render texture
+    UnloadTemplateCache();       // Unload project generation template files
+    UnloadTextMatchers();        // Unload template text matchers
+    UnloadTemplateProvider();   // Unload project template provider (package or zip archive, if used)
 
     // Save application init configuration for next run
     //--------------------------------------------------------------------------------------
@@ -650,37 +1460,27 @@ static void UpdateDrawFrame(void)
             }
             else
             {
+                // NOTE: Previous files scan must be finished before adding new files
+                FinishSourceScan(&sourceScan, &input);
+
                 for (unsigned int i = 0; i < droppedFiles.count; i++)
                 {
                     if (IsPathFile(droppedFiles.paths[i]))
                     {
-                        if (IsFileExtension(droppedFiles.paths[i], ".c;.h"))
+                        if (GetAssetFileKind(droppedFiles.paths[i]) == ASSET_KIND_CODE)
                         {
                             // Add files to source list
                             strcpy(input.srcFilePaths[input.srcFileCount], droppedFiles.paths[i]);
                             input.srcFileCount++;
 
-                            // Scan code file looking for assets
-                            int assetCount = 0;
-                            char **assetPaths = LoadSourceAssetPaths(droppedFiles.paths[i], &assetCount);
-
-                            for (int a = 0; (a < assetCount) && (input.assetFileCount < RPC_MAX_ASSET_FILES); a++)
-                            {
-                                // WARNING: Not verifying at the moment if asset exist, just adding it to assets list
-                                //const char *fullPath = TextFormat("%s/%s", GetDirectoryPath(multiFileList[i]), assetPaths[a]);
-                                //if (FileExists(TextFormat(fullPath))) { }
-                                strcpy(input.assetFilePaths[input.assetFileCount], assetPaths[a]);
-                                input.assetFileCount++;
-                            }
-
-                            UnloadSourceAssetPaths(assetPaths);
+                            // Add code file to assets scan, scanned on worker threads
+                            AddSourceScanFile(&sourceScan, droppedFiles.paths[i]);
                         }
-                        else if (IsFileExtension(droppedFiles.paths[i], ".png;.bmp;.jpg;.qoi;.gif;.raw;.hdr;.ktx;.dxt;.astc;.pvr;.ttf;.otf;.fnt;.wav;.ogg;.mp3;.flac;.mod;.xm;.qoa;.obj;.iqm;.glb;.gltf;.m3d;.vox;.vs;.fs;.txt"))
+                        else if (GetAssetFileKind(droppedFiles.paths[i]) > ASSET_KIND_CODE)
                         {
                             // Add assets to assets list
                             // TODO: Filtering for recognized assets extensions but, really required?
-                            strcpy(input.assetFilePaths[input.assetFileCount], droppedFiles.paths[i]);
-                            input.assetFileCount++;
+                            AddProjectInputAsset(&input, droppedFiles.paths[i]);
                         }
                     }
                     else // Path is a directory
@@ -689,39 +1489,32 @@ static void UpdateDrawFrame(void)
 
                         for (unsigned int l = 0; l < list.count; l++)
                         {
-                            if (IsFileExtension(list.paths[l], ".c;.h"))
+                            if (GetAssetFileKind(list.paths[l]) == ASSET_KIND_CODE)
                             {
                                 // Add files to source list
-                                strcpy(input.srcFilePaths[input.srcFileCount], list.paths[l]);
-                                input.srcFileCount++;
-
-                                // Scan code file looking for assets
-                                int assetCount = 0;
-                                char **assetPaths = LoadSourceAssetPaths(list.paths[l], &assetCount);
-
-                                for (int a = 0; (a < assetCount) && (input.assetFileCount < RPC_MAX_ASSET_FILES); a++)
+                                if (input.srcFileCount < RPC_MAX_SOURCE_FILES)
                                 {
-                                    // WARNING: Not verifying at the moment if asset exist, just adding it to assets list
-                                    //const char *fullPath = TextFormat("%s/%s", GetDirectoryPath(multiFileList[i]), assetPaths[a]);
-                                    //if (FileExists(TextFormat(fullPath))) { }
-                                    strcpy(input.assetFilePaths[input.assetFileCount], assetPaths[a]);
-                                    input.assetFileCount++;
+                                    strcpy(input.srcFilePaths[input.srcFileCount], list.paths[l]);
+                                    input.srcFileCount++;
                                 }
 
-                                UnloadSourceAssetPaths(assetPaths);
+                                // Add code file to assets scan, scanned on worker threads
+                                AddSourceScanFile(&sourceScan, list.paths[l]);
                             }
-                            else if (IsFileExtension(list.paths[l], ".png;.bmp;.jpg;.qoi;.gif;.raw;.hdr;.ktx;.dxt;.astc;.pvr;.ttf;.otf;.fnt;.wav;.ogg;.mp3;.flac;.mod;.xm;.qoa;.obj;.iqm;.glb;.gltf;.m3d;.vox;.vs;.fs;.txt"))
+                            else if (GetAssetFileKind(list.paths[l]) > ASSET_KIND_CODE)
                             {
                                 // Add assets to assets list
                                 // TODO: Filtering for recognized assets extensions but, really required?
-                                strcpy(input.assetFilePaths[input.assetFileCount], list.paths[l]);
-                                input.assetFileCount++;
+                                AddProjectInputAsset(&input, list.paths[l]);
                             }
                         }
 
                         UnloadDirectoryFiles(list);
                     }
                 }
+
+                // Scan dropped code files looking for assets
+                StartSourceScan(&sourceScan);
             }
         }
 
@@ -729,6 +1522,12 @@ static void UpdateDrawFrame(void)
     }
     //----------------------------------------------------------------------------------
 
+    // Source files assets scan logic
+    // NOTE: Scanned asset paths are added to project input once all files are scanned
+    //----------------------------------------------------------------------------------
+    UpdateSourceScan(&sourceScan, &input);
+    //----------------------------------------------------------------------------------
+
     // Keyboard shortcuts
     //------------------------------------------------------------------------------------
     // Toggle window: help
@@ -745,7 +1544,7 @@ static void UpdateDrawFrame(void)
     {
         // Initialize project config (with default values)
         rpcUnloadProjectConfig(project);
-        project = rpcLoadProjectConfig("template/project_name.rpc");
+        project = LoadTemplateProjectConfig();
 
         selectedTemplate = 1;   // Basic window
 
@@ -805,6 +1604,7 @@ static void UpdateDrawFrame(void)
                 }
 
                 input.assetFileCount--;
+                input.assetLookupCount = -1;
                 i--;
             }
         }
@@ -931,6 +1731,7 @@ static void UpdateDrawFrame(void)
         showLoadDirectoryDialog ||
         showProjectGenPathDialog ||
         showGenProjectProgress ||
+        (sourceScan.pool != NULL) ||
         showAddInputFilesDialog ||
         showAddInputDirectoryDialog) lockBackground = true;
     else lockBackground = false;
@@ -1301,24 +2102,15 @@ static void UpdateDrawFrame(void)
             int multiFileCount = 0;
             const char **multiFileList = GetSubtextPtrs(multiFileNames, '|', &multiFileCount); // Split text into multiple strings
 
+            // NOTE: Previous files scan must be finished before adding new files
+            FinishSourceScan(&sourceScan, &input);
+
             for (int i = 0; i < multiFileCount; i++)
             {
-                if (IsFileExtension(multiFileList[i], ".c;.h"))
+                if (GetAssetFileKind(multiFileList[i]) == ASSET_KIND_CODE)
                 {
-                    // Scan code file looking for assets
-                    int assetCount = 0;
-                    char **assetPaths = LoadSourceAssetPaths(multiFileList[i], &assetCount);
-
-                    for (int a = 0; (a < assetCount) && (input.assetFileCount < RPC_MAX_ASSET_FILES); a++)
-                    {
-                        // NOTE: Not verifying at the moment if asset exist, just adding it to assets list
-                        // const char *fullPath = TextFormat("%s/%s", GetDirectoryPath(multiFileList[i]), assetPaths[a]);
-                        //if (FileExists(TextFormat(fullPath))) { }
-                        strcpy(input.assetFilePaths[input.assetFileCount], assetPaths[a]);
-                        input.assetFileCount++;
-                    }
-
-                    UnloadSourceAssetPaths(assetPaths);
+                    // Add code file to assets scan, scanned on worker threads
+                    AddSourceScanFile(&sourceScan, multiFileList[i]);
 
                     // Add files to source list
                     if (input.srcFileCount < RPC_MAX_SOURCE_FILES)
@@ -1327,17 +2119,16 @@ static void UpdateDrawFrame(void)
                         input.srcFileCount++;
                     }
                 }
-                else if (IsFileExtension(multiFileList[i], ".png;.bmp;.jpg;.qoi;.gif;.raw;.hdr;.ktx;.dxt;.astc;.pvr;.ttf;.otf;.fnt;.wav;.ogg;.mp3;.flac;.mod;.xm;.qoa;.obj;.iqm;.glb;.gltf;.m3d;.vox;.vs;.fs;.txt"))
+                else if (GetAssetFileKind(multiFileList[i]) > ASSET_KIND_CODE)
                 {
                     // Add assets to assets list
                     // TODO: Filtering for recognized assets extensions but, really required?
-                    if (input.assetFileCount < RPC_MAX_ASSET_FILES)
-                    {
-                        strcpy(input.assetFilePaths[input.assetFileCount], multiFileList[i]);
-                        input.assetFileCount++;
-                    }
+                    AddProjectInputAsset(&input, multiFileList[i]);
                 }
             }
+
+            // Scan selected code files looking for assets
+            StartSourceScan(&sourceScan);
         }
 
         if (result >= 0) showAddInputFilesDialog = false;
@@ -1357,26 +2148,17 @@ static void UpdateDrawFrame(void)
         {
             if (DirectoryExists(inDirectoryPath))
             {
+                // NOTE: Previous directory scan must be finished before adding new files
+                FinishSourceScan(&sourceScan, &input);
+
                 FilePathList pathList = LoadDirectoryFilesEx(inDirectoryPath, "FILES*", true);
 
                 for (unsigned int i = 0; i < pathList.count; i++)
                 {
-                    if (IsFileExtension(pathList.paths[i], ".c;.h"))
+                    if (GetAssetFileKind(pathList.paths[i]) == ASSET_KIND_CODE)
                     {
-                        // Scan code file looking for assets
-                        int assetCount = 0;
-                        char **assetPaths = LoadSourceAssetPaths(pathList.paths[i], &assetCount);
-
-                        for (int a = 0; (a < assetCount) && (input.assetFileCount < RPC_MAX_ASSET_FILES); a++)
-                        {
-                            // TODO: WARNING: Assets should be validatd  if they exist, adjusting src path if required
-                            // const char *fullPath = TextFormat("%s/%s", GetDirectoryPath(pathList.paths[i]), assetPaths[a]);
-                            //if (FileExists(TextFormat(fullPath))) { }
-                            strcpy(input.assetFilePaths[input.assetFileCount], assetPaths[a]);
-                            input.assetFileCount++;
-                        }
-
-                        UnloadSourceAssetPaths(assetPaths);
+                        // Add code file to assets scan, scanned on worker threads
+                        AddSourceScanFile(&sourceScan, pathList.paths[i]);
 
                         // Add files to source list
                         if (input.srcFileCount < RPC_MAX_SOURCE_FILES)
@@ -1385,19 +2167,18 @@ static void UpdateDrawFrame(void)
                             input.srcFileCount++;
                         }
                     }
-                    else if (IsFileExtension(pathList.paths[i], ".png;.bmp;.jpg;.qoi;.gif;.raw;.hdr;.ktx;.dxt;.astc;.pvr;.ttf;.otf;.fnt;.wav;.ogg;.mp3;.flac;.mod;.xm;.qoa;.obj;.iqm;.glb;.gltf;.m3d;.vox;.vs;.fs;.txt"))
+                    else if (GetAssetFileKind(pathList.paths[i]) > ASSET_KIND_CODE)
                     {
                         // Add assets to assets list
                         // TODO: Filtering for recognized assets extensions but, really required?
-                        if (input.assetFileCount < RPC_MAX_ASSET_FILES)
-                        {
-                            strcpy(input.assetFilePaths[input.assetFileCount], pathList.paths[i]);
-                            input.assetFileCount++;
-                        }
+                        AddProjectInputAsset(&input, pathList.paths[i]);
                     }
                 }
 
                 UnloadDirectoryFiles(pathList);
+
+                // Scan directory code files looking for assets
+                StartSourceScan(&sourceScan);
             }
             else
             {
@@ -1513,6 +2294,33 @@ static void UpdateDrawFrame(void)
     }
     //----------------------------------------------------------------------------------------
 
+    // GUI: Source Files Scan Progress
+    //----------------------------------------------------------------------------------------
+    if (sourceScan.pool != NULL)
+    {
+        int scannedCount = GetWorkerTasksCompleted(sourceScan.pool);
+        float scanProgress = 100.0f*(float)scannedCount/(float)sourceScan.fileCount;
+
+        GuiPanel((Rectangle){ -10, screenHeight/2 - 100, screenWidth + 20, 200 }, NULL);
+
+        int textSpacing = GuiGetStyle(DEFAULT, TEXT_SPACING);
+        GuiSetStyle(DEFAULT, TEXT_SIZE, GuiGetFont().baseSize*3);
+        GuiSetStyle(DEFAULT, TEXT_SPACING, 3);
+        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_CENTER);
+        GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED));
+        GuiLabel((Rectangle){ -10, screenHeight/2 - 60, screenWidth + 20, 30 }, "SCANNING SOURCE FILES...");
+        GuiSetStyle(LABEL, TEXT_COLOR_NORMAL, GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL));
+        GuiSetStyle(DEFAULT, TEXT_SIZE, GuiGetFont().baseSize*2);
+
+        GuiProgressBar((Rectangle){ 12, screenHeight/2, screenWidth - 24, 20 }, NULL, NULL, &scanProgress, 0, 100);
+        GuiLabel((Rectangle){ -10, screenHeight/2 + 40, screenWidth + 20, 30 }, TextFormat("%i/%i files scanned", scannedCount, sourceScan.fileCount));
+
+        GuiSetStyle(LABEL, TEXT_ALIGNMENT, TEXT_ALIGN_LEFT);
+        GuiSetStyle(DEFAULT, TEXT_SIZE, GuiGetFont().baseSize);
+        GuiSetStyle(DEFAULT, TEXT_SPACING, textSpacing);
+    }
+    //----------------------------------------------------------------------------------------
+
     // GUI: Export Project Dialog (and saving logic)
     //----------------------------------------------------------------------------------------
     if (showGenProjectProgress)
@@ -1620,7 +2428,11 @@ static void ShowCommandLineInfo(void)
     printf("          [-cn <commercial_name>] [-pv <version>]\n");
     printf("          [--desc <project_description>] [--dev <developer_name>]\n");
     printf("          [--devurl <developer_webpage>] [--devmail <developer_email>]\n");
-    printf("          [--output <output_path>]\n");
+    printf("          [--output <output_path>] [--jobs <threads_count>]\n");
+    printf("          [--assets-link <link_mode>] [--dry-run] [--plan-json <plan_file.json>]\n");
+    printf("          [--profile <trace_file.json>]\n");
+    printf("          [--batch <manifest.csv|rpc_dir>] [--batch-parallel <projects_count>]\n");
+    printf("          [--compile-templates <header_file.h>]\n");
 
     printf("\nOPTIONS:\n\n");
     printf("    -h, --help                          : Show tool version and command line usage help\n\n");
@@ -1628,6 +2440,26 @@ static void ShowCommandLineInfo(void)
     printf("                                        : Define inputs, directory or files(s), comma separated\n");
     printf("                                        : NOTE: Provide full paths or prepend './' for relative paths\n");
     printf("    -o, --output <output_path>          : Define output path for project generation\n");
+    printf("    -j, --jobs <threads_count>          : Define worker threads for project generation\n");
+    printf("                                        : NOTE: Default value 0 uses all available processors\n");
+    printf("    --assets-link <link_mode>           : Define project assets staging mode on generation:\n");
+    printf("                                          Supported values:\n");
+    printf("                                            COPY - Copy assets files (default)\n");
+    printf("                                            LINK - Hardlink assets files, symlink if crossing file systems\n");
+    printf("                                            SYMLINK - Symlink assets files\n");
+    printf("                                        : NOTE: Assets files are copied if links can not be created\n");
+    printf("    --dry-run                           : Plan project generation without writing any output\n");
+    printf("    --plan-json <plan_file.json>        : Save project generation plan operations, dependencies and sizes\n");
+    printf("    --profile <trace_file.json>         : Save project generation timings and bytes read/written per phase\n");
+    printf("                                        : NOTE: Chrome trace_event format, open with chrome://tracing or ui.perfetto.dev\n");
+    printf("    --batch <manifest.csv|rpc_dir>      : Generate multiple projects, command line properties used as base:\n");
+    printf("                                          CSV file: Header row with .rpc keys and TEMPLATE, INPUT, OUTPUT columns,\n");
+    printf("                                            one project per row, INPUT paths separated by ';'\n");
+    printf("                                          Directory: One project per .rpc file, its PROJECT_SOURCE_PATH used as input\n");
+    printf("    --batch-parallel <projects_count>   : Define batch projects generated in parallel, sharing worker threads\n");
+    printf("                                        : NOTE: Projects generated in parallel must use different output paths\n");
+    printf("    --compile-templates <header_file.h> : Save precompiled template files as C header, no project generated\n");
+    printf("                                        : NOTE: Build with SUPPORT_COMPILED_TEMPLATES to embed them (make templates)\n");
     printf("    -c, --config <config_file.rpc>      : Define input project configuration file\n");
     printf("                                        : NOTE: Use as base properties, override by cli properties\n");
     printf("    -t, --template <template_id>        : Define project template to be used:\n");
@@ -1651,6 +2483,8 @@ static void ShowCommandLineInfo(void)
     printf("\nEXAMPLES:\n\n");
     printf("    > rpc -i src_dir -c my_project_config.rpc -pn cool_game -rn cool-game-repo -cn \"Cool Game\" -pv 1.0\n");
     printf("        Generates project <cool_game> in output directory <cool-game-repo>\n");
+    printf("    > rpc --batch projects.csv -o output --batch-parallel 4\n");
+    printf("        Generates all projects defined in <projects.csv>, 4 projects at a time\n");
 }
 
 // Process command line input
@@ -1659,13 +2493,31 @@ static void ProcessCommandLine(int argc, char *argv[])
 {
     // CLI required variables
     bool showUsageInfo = false;     // Toggle command line usage info
+    bool dryRun = false;            // Plan project generation only, nothing is written
+    char planFileName[256] = { 0 }; // Project generation plan output file (.json)
+    char batchFileName[256] = { 0 }; // Batch manifest: CSV file or directory with .rpc files
+    int batchParallelCount = 1;     // Batch projects generated in parallel
+    char compiledFileName[256] = { 0 }; // Precompiled templates output file (.h)
 
     if (argc == 1) showUsageInfo = true;
 
+    // Check profiling request first, to also profile command line processing
+    char profileFileName[256] = { 0 };
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--profile") == 0) && ((i + 1) < argc) && (argv[i + 1][0] != '-'))
+        {
+            strcpy(profileFileName, argv[i + 1]);
+            InitProfiler();
+        }
+    }
+
     // Load default project config file
     // NOTE 1: If a different .rpc is provided, defined properties will be overriden
     // NOTE 2: Properties defined on command-line will also override default ones
-    rpcProjectConfig config = rpcLoadProjectConfig("template/project_name.rpc");
+    int profileEvent = BeginProfileEvent("rpcLoadProjectConfig", "input");
+    rpcProjectConfig config = LoadTemplateProjectConfig();
+    EndProfileEvent(profileEvent, GetFileLength("template/project_name.rpc"), 0);
     rpcProjectInput input = rpcLoadProjectInput();
     int selectedTemplate = 0;
 
@@ -1682,52 +2534,7 @@ static void ProcessCommandLine(int argc, char *argv[])
             if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
             {
                 // Split provided arg by ',' to get multiple source input files
-                int fileCount = 0;
-                char **files = TextSplit(argv[i + 1], ',', &fileCount);
-
-                for (int j = 0; j < fileCount; j++)
-                {
-                    if (IsPathFile(files[j]))
-                    {
-                        if (IsFileExtension(files[j], ".c;.h"))
-                        {
-                            // Add files to source list
-                            // TODO: Get full path for input file or prepend "./" for relative paths?
-                            strcpy(input.srcFilePaths[input.srcFileCount], files[j]);
-                            input.srcFileCount++;
-                        }
-                        else if (IsFileExtension(files[j], ".png;.bmp;.jpg;.qoi;.gif;.raw;.hdr;.ktx;.dxt;.astc;.pvr;.ttf;.otf;.fnt;.wav;.ogg;.mp3;.flac;.mod;.xm;.qoa;.obj;.iqm;.glb;.gltf;.m3d;.vox;.vs;.fs;.txt"))
-                        {
-                            // Add assets to assets list
-                            // TODO: Filtering for recognized assets extensions but, really required?
-                            strcpy(input.assetFilePaths[input.assetFileCount], files[j]);
-                            input.assetFileCount++;
-                        }
-                    }
-                    else // Path is a directory
-                    {
-                        FilePathList list = LoadDirectoryFilesEx(files[j], "FILES*", true);
-
-                        for (unsigned int l = 0; l < list.count; l++)
-                        {
-                            if (IsFileExtension(list.paths[l], ".c;.h"))
-                            {
-                                // Add files to source list
-                                strcpy(input.srcFilePaths[input.srcFileCount], list.paths[l]);
-                                input.srcFileCount++;
-                            }
-                            else if (IsFileExtension(list.paths[l], ".png;.bmp;.jpg;.qoi;.gif;.raw;.hdr;.ktx;.dxt;.astc;.pvr;.ttf;.otf;.fnt;.wav;.ogg;.mp3;.flac;.mod;.xm;.qoa;.obj;.iqm;.glb;.gltf;.m3d;.vox;.vs;.fs;.txt"))
-                            {
-                                // Add assets to assets list
-                                // TODO: Filtering for recognized assets extensions but, really required?
-                                strcpy(input.assetFilePaths[input.assetFileCount], list.paths[l]);
-                                input.assetFileCount++;
-                            }
-                        }
-
-                        UnloadDirectoryFiles(list);
-                    }
-                }
+                AddProjectInputPaths(&input, argv[i + 1], ',');
             }
             else LOG("WARNING: No input file provided\n");
         }
@@ -1737,7 +2544,9 @@ static void ProcessCommandLine(int argc, char *argv[])
             {
                 if (FileExists(argv[i + 1]) && IsFileExtension(argv[i + 1], ".rpc"))
                 {
+                    int configEvent = BeginProfileEvent("rpcLoadProjectConfig", "input");
                     rpcProjectConfig tempConfig = rpcLoadProjectConfig(argv[i + 1]);
+                    EndProfileEvent(configEvent, GetFileLength(argv[i + 1]), 0);
 
                     // TODO: WARNING: Provided .rpc could not have all required fields defined,
                     // so it's better to sync available ones with already loaded config from template
@@ -1855,921 +2664,5765 @@ static void ProcessCommandLine(int argc, char *argv[])
             }
             else LOG("WARNING: Output path provided not valid\n");
         }
+        else if ((strcmp(argv[i], "-j") == 0) || (strcmp(argv[i], "--jobs") == 0))
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                generationThreadCount = TextToInteger(argv[i + 1]);
+
+                if ((generationThreadCount < 0) || (generationThreadCount > RPC_MAX_WORKER_THREADS)) generationThreadCount = 0;
+
+                i++;
+            }
+            else LOG("WARNING: Worker threads count provided not valid\n");
+        }
+        else if (strcmp(argv[i], "--assets-link") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                if (rpcGetText(config, "PROJECT_ASSETS_LINK_MODE") != NULL) rpcSetText(config, "PROJECT_ASSETS_LINK_MODE", argv[i + 1]);
+                else LOG("WARNING: Project configuration does not support assets link mode\n");
+
+                i++;
+            }
+            else LOG("WARNING: Assets link mode provided not valid\n");
+        }
+        else if (strcmp(argv[i], "--profile") == 0)
+        {
+            // NOTE: Profiling already initialized before arguments processing
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-')) i++;
+            else LOG("WARNING: Profile output file provided not valid\n");
+        }
+        else if (strcmp(argv[i], "--dry-run") == 0)
+        {
+            dryRun = true;
+        }
+        else if (strcmp(argv[i], "--plan-json") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                strcpy(planFileName, argv[i + 1]);
+                i++;
+            }
+            else LOG("WARNING: Plan output file provided not valid\n");
+        }
+        else if (strcmp(argv[i], "--batch") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                strcpy(batchFileName, argv[i + 1]);
+                i++;
+            }
+            else LOG("WARNING: Batch manifest provided not valid\n");
+        }
+        else if (strcmp(argv[i], "--batch-parallel") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                batchParallelCount = TextToInteger(argv[i + 1]);
+
+                if (batchParallelCount < 1) batchParallelCount = 1;
+
+                i++;
+            }
+            else LOG("WARNING: Batch parallel projects count provided not valid\n");
+        }
+        else if (strcmp(argv[i], "--compile-templates") == 0)
+        {
+            if (((i + 1) < argc) && (argv[i + 1][0] != '-'))
+            {
+                strcpy(compiledFileName, argv[i + 1]);
+                i++;
+            }
+            else LOG("WARNING: Precompiled templates output file provided not valid\n");
+        }
     }
 
-    if (input.srcFileCount == 0)
+    if ((input.srcFileCount == 0) && (selectedTemplate > 0)) rpcUpdateProjectInput(&input, selectedTemplate);
+
+    if (compiledFileName[0] != '\0')
     {
-        if (selectedTemplate > 0) rpcUpdateProjectInput(&input, selectedTemplate);
-        else LOG("WARNING: No valid input source files provided and no valid template selected\n");
+        // NOTE: Templates compilation replaces project generation
+        if (!SaveCompiledTemplates(compiledFileName)) LOG("WARNING: Precompiled templates could not be saved: %s\n", compiledFileName);
     }
+    else if (batchFileName[0] != '\0')
+    {
+        // NOTE: Command line input and properties are used as base for all batch projects
+        if (planFileName[0] != '\0') LOG("WARNING: Project generation plan can not be saved on batch generation\n");
 
-    if (input.srcFileCount > 0)
+        GenerateProjectBatch(config, input, batchFileName, batchParallelCount, dryRun);
+    }
+    else if (input.srcFileCount == 0) LOG("WARNING: No valid input source files provided and no valid template selected\n");
+    else
     {
         // Generate raylib project structure
-        GenerateProject(config, input, generationOutPath);
+        // NOTE: Plan is saved before execution, dry run does not write any project output
+        GenPlan plan = LoadGenPlan(config, input, generationOutPath, NULL);
+
+        if (plan.valid)
+        {
+            if (planFileName[0] != '\0')
+            {
+                if (SaveGenPlanJSON(&plan, planFileName)) LOG("INFO: Project generation plan saved: %s\n", planFileName);
+                else LOG("WARNING: Project generation plan could not be saved: %s\n", planFileName);
+            }
+
+            if (dryRun) LogGenPlanDryRun(&plan);
+            else ExecuteGenPlan(&plan);
+        }
+
+        UnloadGenPlan(&plan);
     }
 
     rpcUnloadProjectConfig(config);
     rpcUnloadProjectInput(input);
+    UnloadScanCache();
+    UnloadTemplateCache();
+    UnloadTextMatchers();
+
+    if (profileFileName[0] != '\0') CloseProfiler(profileFileName);
 
     if (showUsageInfo) ShowCommandLineInfo();
 }
-#endif // PLATFORM_DESKTOP
 
-//--------------------------------------------------------------------------------------------
-// Load/Save/Export functions
-//--------------------------------------------------------------------------------------------
-// NOTE: rpconfig.h provides required functions, shared by [rpc] and [rpb] tools
+// Save text as C string literal, escaping required characters
+static void SaveCText(FILE *file, const char *text)
+{
+    fputc('"', file);
 
-//--------------------------------------------------------------------------------------------
-// Auxiliar functions (utilities)
-//--------------------------------------------------------------------------------------------
+    for (const char *ptr = (text != NULL)? text : ""; *ptr != '\0'; ptr++)
+    {
+        if ((*ptr == '"') || (*ptr == '\\')) fprintf(file, "\\%c", *ptr);
+        else if (*ptr == '\n') fprintf(file, "\\n");
+        else if (*ptr == '\t') fprintf(file, "\\t");
+        else if ((unsigned char)*ptr < 0x20) fprintf(file, "\\%03o", (unsigned char)*ptr);
+        else fputc(*ptr, file);
+    }
 
-// Load project source/asset file paths bucket
-static rpcProjectInput rpcLoadProjectInput(void)
+    fputc('"', file);
+}
+
+// Save precompiled template files as C header
+// NOTE: Templates are compiled for every replacements patterns table used on generation,
+// all templates generation plans are loaded with all build systems requested
+static bool SaveCompiledTemplates(const char *fileName)
 {
-    rpcProjectInput input = { 0 };
+    FILE *file = fopen(fileName, "wt");
+    if (file == NULL) return false;
 
-    input.srcFilePaths = (char **)RL_CALLOC(RPC_MAX_SOURCE_FILES, sizeof(char *));
-    input.assetFilePaths = (char **)RL_CALLOC(RPC_MAX_ASSET_FILES, sizeof(char *));
+    fprintf(file, "// Precompiled template files: literal text spans and replacement pattern slots\n");
+    fprintf(file, "// WARNING: File generated by [rpc] tool (make templates), do not edit\n");
+    fprintf(file, "// NOTE: Spans refer to template file text, template files must be the ones compiled (size and hash)\n\n");
+    fprintf(file, "#ifndef RPC_TEMPLATES_H\n#define RPC_TEMPLATES_H\n\n");
 
-    for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) input.srcFilePaths[i] = (char *)RL_CALLOC(RPC_SOURCE_PATH_LENGTH, sizeof(char));
-    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) input.assetFilePaths[i] = (char *)RL_CALLOC(RPC_ASSET_PATH_LENGTH, sizeof(char));
+    rpcProjectConfig config = rpcLoadProjectConfig("template/project_name.rpc");
+    rpcProjectInput input = rpcLoadProjectInput();
+    for (int i = 0; i < 6; i++) input.requestedBuildSystems[i] = true;
 
-    input.requestedBuildSystems[0] = true;  // Scripts
-    input.requestedBuildSystems[1] = true;  // Makefile
-    input.requestedBuildSystems[2] = true;  // VSCode
-    input.requestedBuildSystems[3] = true;  // VS2022
-    input.requestedBuildSystems[4] = false; // CMake
-    input.requestedBuildSystems[5] = true;  // GitHub Actions
+    // Compiled templates, registered to avoid duplicates (same file and patterns)
+    TemplateFile *compiledFiles[RPC_MAX_COMPILED_TEMPLATES] = { 0 };
+    const TextMatcher *compiledMatchers[RPC_MAX_COMPILED_TEMPLATES] = { 0 };
+    int compiledPatternCounts[RPC_MAX_COMPILED_TEMPLATES] = { 0 };
+    int compiledSpanCounts[RPC_MAX_COMPILED_TEMPLATES] = { 0 };
+    int compiledCount = 0;
 
-    input.srcFileSelected = (bool *)RL_CALLOC(RPC_MAX_SOURCE_FILES, sizeof(bool));
-    input.assetFileSelected = (bool *)RL_CALLOC(RPC_MAX_ASSET_FILES, sizeof(bool));
+    for (int t = 1; t <= 5; t++)
+    {
+        rpcUpdateProjectInput(&input, t);
+        GenPlan plan = LoadGenPlan(config, input, ".", NULL);
 
-    return input;
-}
+        for (int i = 0; i < plan.fileJobs.count; i++)
+        {
+            const GenJob *job = &plan.fileJobs.jobs[i];
+            if ((job->type != GEN_JOB_RENDER) || (job->templateFile == NULL)) continue;
 
-// Unload project source/asset file paths bucket
-static void rpcUnloadProjectInput(rpcProjectInput input)
-{
-    for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) RL_FREE(input.srcFilePaths[i]);
-    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) RL_FREE(input.assetFilePaths[i]);
+            // NOTE: Text matchers are cached, same matcher means same patterns table
+            bool found = false;
+            for (int c = 0; c < compiledCount; c++)
+            {
+                if ((strcmp(compiledFiles[c]->key, job->templateFile->key) == 0) && (compiledMatchers[c] == job->matcher)) { found = true; break; }
+            }
 
-    RL_FREE(input.srcFilePaths);
-    RL_FREE(input.assetFilePaths);
-    RL_FREE(input.srcFileSelected);
-    RL_FREE(input.assetFileSelected);
-}
+            if (found || (compiledCount >= RPC_MAX_COMPILED_TEMPLATES)) continue;
 
-// Update input data by selected template
-void rpcUpdateProjectInput(rpcProjectInput *input, int selTemplate)
-{
-    // Clear input data content to refill
-    for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++)
-    {
-        memset(input->srcFilePaths[i], 0, RPC_SOURCE_PATH_LENGTH);
-        input->srcFileSelected[i] = false;
+            // NOTE: Template file reference added from template cache, kept until header is saved
+            TemplateFile *templateFile = LoadTemplateFile(job->srcPath);
+            if (templateFile == NULL) continue;
+
+            int spanCount = 0;
+            TemplateSpan *spans = CompileTextTemplate(job->matcher, 0, templateFile->text, &spanCount);
+
+            fprintf(file, "// Template: %s\n", templateFile->key);
+            fprintf(file, "static const char *compiledTemplatePatterns%02i[] = { ", compiledCount);
+            for (int p = 0; p < job->replacementCount; p++) { SaveCText(file, job->matcher->patterns[p]); fprintf(file, (p < (job->replacementCount - 1))? ", " : " };\n"); }
+
+            fprintf(file, "static const TemplateSpan compiledTemplateSpans%02i[] = {", compiledCount);
+            for (int s = 0; s < spanCount; s++) fprintf(file, "%s{ %i, %i, %i },", ((s%6) == 0)? "\n    " : " ", spans[s].offset, spans[s].length, spans[s].slot);
+            if (spanCount == 0) fprintf(file, "\n    { 0, 0, -1 },");    // Empty template, array can not be empty
+            fprintf(file, "\n};\n\n");
+
+            compiledFiles[compiledCount] = templateFile;
+            compiledMatchers[compiledCount] = job->matcher;
+            compiledPatternCounts[compiledCount] = job->replacementCount;
+            compiledSpanCounts[compiledCount] = spanCount;
+            compiledCount++;
+
+            RL_FREE(spans);
+        }
+
+        UnloadGenPlan(&plan);
     }
-    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++)
+
+    fprintf(file, "static const CompiledTemplate compiledTemplates[] = {\n");
+    for (int c = 0; c < compiledCount; c++)
     {
-        memset(input->assetFilePaths[i], 0, RPC_ASSET_PATH_LENGTH);
-        input->assetFileSelected[i] = false;
+        fprintf(file, "    { ");
+        SaveCText(file, compiledFiles[c]->key);
+        fprintf(file, ", %i, 0x%016llxULL, %i, compiledTemplatePatterns%02i, %i, compiledTemplateSpans%02i },\n",
+            compiledFiles[c]->size, compiledFiles[c]->hash, compiledPatternCounts[c], c, compiledSpanCounts[c], c);
     }
-    input->srcFileCount = 0;
-    input->assetFileCount = 0;
+    if (compiledCount == 0) fprintf(file, "    { \"\", 0, 0, 0, NULL, 0, NULL },\n");
+    fprintf(file, "};\n\n");
+    fprintf(file, "static const int compiledTemplateCount = %i;\n\n", compiledCount);
+    fprintf(file, "#endif // RPC_TEMPLATES_H\n");
 
-    char templatePath[256] = { 0 };
-    // NOTE: [template] directory must be in same directory as [rpc] tool
-    //strcpy(templatePath, TextFormat("%s/template", GetApplicationDirectory()));
-    // WARNING: Instead of copying full template path, assume that the file can be
-    // located in [template] package (next to binary or internal), so no need to specify
-    // a full path; full paths are only used for user-provided files
-    strcpy(templatePath, "template");
+    fclose(file);
 
-    if (selTemplate == 0)       // Custom
-    {
-        // NOTE: Filled with user provided source files
-        // TODO: Scan required assets and add to the list
-    }
-    else if (selTemplate == 1)  // Basic Window
-    {
+    for (int c = 0; c < compiledCount; c++) UnloadTemplateFile(compiledFiles[c]);
+
+    rpcUnloadProjectInput(input);
+    rpcUnloadProjectConfig(config);
+
+    LOG("INFO: Precompiled templates saved: %s (%i templates)\n", fileName, compiledCount);
+
+    return true;
+}
+
+// Add project input files, directories are scanned for source and asset files
+// NOTE: Multiple paths can be provided, separated by delimiter
+static void AddProjectInputPaths(rpcProjectInput *input, const char *paths, char delimiter)
+{
+    int fileCount = 0;
+    char **files = TextSplit(paths, delimiter, &fileCount);
+
+    for (int j = 0; j < fileCount; j++)
+    {
+        if (IsPathFile(files[j]))
+        {
+            if (GetAssetFileKind(files[j]) == ASSET_KIND_CODE)
+            {
+                // Add files to source list
+                // TODO: Get full path for input file or prepend "./" for relative paths?
+                if (input->srcFileCount < RPC_MAX_SOURCE_FILES)
+                {
+                    strcpy(input->srcFilePaths[input->srcFileCount], files[j]);
+                    input->srcFileCount++;
+                }
+            }
+            else if (GetAssetFileKind(files[j]) > ASSET_KIND_CODE)
+            {
+                // Add assets to assets list
+                // TODO: Filtering for recognized assets extensions but, really required?
+                AddProjectInputAsset(input, files[j]);
+            }
+        }
+        else // Path is a directory
+        {
+            FilePathList list = LoadDirectoryFilesEx(files[j], "FILES*", true);
+
+            for (unsigned int l = 0; l < list.count; l++)
+            {
+                if (GetAssetFileKind(list.paths[l]) == ASSET_KIND_CODE)
+                {
+                    // Add files to source list
+                    if (input->srcFileCount < RPC_MAX_SOURCE_FILES)
+                    {
+                        strcpy(input->srcFilePaths[input->srcFileCount], list.paths[l]);
+                        input->srcFileCount++;
+                    }
+                }
+                else if (GetAssetFileKind(list.paths[l]) > ASSET_KIND_CODE)
+                {
+                    // Add assets to assets list
+                    // TODO: Filtering for recognized assets extensions but, really required?
+                    AddProjectInputAsset(input, list.paths[l]);
+                }
+            }
+
+            UnloadDirectoryFiles(list);
+        }
+    }
+}
+
+// Set project config property from text, integer properties are converted
+// NOTE: Returns -1 if key not found or value not changed
+static int SetProjectConfigProperty(rpcProjectConfig config, const char *key, const char *text)
+{
+    int result = -1;
+    rpcPropertyEntry *entry = rpcGetPropertyEntry(config, key);
+
+    if (entry != NULL)
+    {
+        if ((entry->type == RPC_TYPE_BOOL) || (entry->type == RPC_TYPE_VALUE)) result = rpcSetValue(config, key, TextToInteger(text));
+        else result = rpcSetText(config, key, text);
+    }
+
+    return result;
+}
+
+// Log project generation plan summary, nothing written
+static void LogGenPlanDryRun(const GenPlan *plan)
+{
+    int fileCount = 1;      // Project configuration file (.rpc)
+    long long totalSize = plan->configJob.size;
+
+    for (int i = 0; i < plan->fileJobs.count; i++)
+    {
+        if (plan->fileJobs.jobs[i].type != GEN_JOB_LOG) { fileCount++; totalSize += plan->fileJobs.jobs[i].size; }
+    }
+
+    LOG("INFO: Dry run, nothing written: %i directories, %i files, %lld bytes estimated\n", plan->dirJobs.count, fileCount, totalSize);
+    if (GetTemplateArchiveCount() > 0) LOG("INFO: Template archive files extracted: %i/%i (%i bytes)\n", templateCache.archiveLoadCount, GetTemplateArchiveCount(), templateCache.archiveLoadSize);
+    LOG("INFO: Dry run plan memory: %i KB, %i allocations\n", (int)(plan->arena->size/1024), plan->arena->allocCount);
+}
+
+// Load batch manifest: CSV file or directory with project configuration files (.rpc)
+// NOTE: CSV empty lines and lines starting with '#' are skipped, first line is header row
+static BatchManifest LoadBatchManifest(const char *fileName)
+{
+    BatchManifest manifest = { 0 };
+
+    if (DirectoryExists(fileName))
+    {
+        manifest.configFiles = LoadDirectoryFilesEx(fileName, ".rpc", false);
+        manifest.count = manifest.configFiles.count;
+    }
+    else if (FileExists(fileName))
+    {
+        manifest.text = LoadFileText(fileName);
+
+        char *fields[RPC_MAX_BATCH_COLUMNS] = { 0 };
+        int capacity = 0;
+
+        for (char *line = manifest.text, *next = NULL; line != NULL; line = next)
+        {
+            next = strchr(line, '\n');
+            if (next != NULL) { *next = '\0'; next++; }
+
+            int length = (int)strlen(line);
+            if ((length > 0) && (line[length - 1] == '\r')) { length--; line[length] = '\0'; }
+            if ((length == 0) || (line[0] == '#')) continue;
+
+            int fieldCount = SplitCSVLine(line, fields, RPC_MAX_BATCH_COLUMNS);
+
+            if (manifest.columns == NULL)
+            {
+                manifest.columnCount = fieldCount;
+                manifest.columns = (char **)RL_CALLOC(fieldCount, sizeof(char *));
+                memcpy(manifest.columns, fields, fieldCount*sizeof(char *));
+            }
+            else
+            {
+                if (manifest.count >= capacity)
+                {
+                    capacity = (capacity > 0)? capacity*2 : 64;
+                    manifest.cells = (char **)RL_REALLOC(manifest.cells, capacity*manifest.columnCount*sizeof(char *));
+                }
+
+                char **row = &manifest.cells[manifest.count*manifest.columnCount];
+                for (int c = 0; c < manifest.columnCount; c++) row[c] = (c < fieldCount)? fields[c] : NULL;
+
+                manifest.count++;
+            }
+        }
+    }
+
+    return manifest;
+}
+
+// Unload batch manifest
+static void UnloadBatchManifest(BatchManifest *manifest)
+{
+    if (manifest->configFiles.paths != NULL) UnloadDirectoryFiles(manifest->configFiles);
+    UnloadFileText(manifest->text);
+    RL_FREE(manifest->columns);
+    RL_FREE(manifest->cells);
+
+    memset(manifest, 0, sizeof(BatchManifest));
+}
+
+// Split CSV line into fields, line text is modified
+// NOTE: Quoted fields can contain separators and escaped quotes (""), but not line breaks
+static int SplitCSVLine(char *line, char **fields, int maxFields)
+{
+    int count = 0;
+    char *ptr = line;
+
+    while (count < maxFields)
+    {
+        // NOTE: Field text is unescaped in place, output never goes ahead of input
+        char *field = ptr;
+        char *out = ptr;
+
+        if (*ptr == '"')
+        {
+            ptr++;
+
+            while (*ptr != '\0')
+            {
+                if ((ptr[0] == '"') && (ptr[1] == '"')) { *out++ = '"'; ptr += 2; }
+                else if (ptr[0] == '"') { ptr++; break; }
+                else *out++ = *ptr++;
+            }
+        }
+
+        while ((*ptr != ',') && (*ptr != '\0')) *out++ = *ptr++;
+
+        bool lastField = (*ptr == '\0');
+        *out = '\0';
+        fields[count] = field;
+        count++;
+
+        if (lastField) break;
+        ptr++;
+    }
+
+    return count;
+}
+
+// Generate all projects defined in batch manifest
+// NOTE: Base project configuration and input are parsed once and reused for all projects,
+// every project is planned from a copy with its manifest overrides applied, projects are
+// executed in groups of parallelCount plans, sharing worker threads
+static void GenerateProjectBatch(rpcProjectConfig config, rpcProjectInput input, const char *manifestPath, int parallelCount, bool dryRun)
+{
+    BatchManifest manifest = LoadBatchManifest(manifestPath);
+
+    if (manifest.count == 0)
+    {
+        LOG("WARNING: Batch manifest not valid or no projects defined: %s\n", manifestPath);
+        UnloadBatchManifest(&manifest);
+        return;
+    }
+
+    // Get CSV special columns, other columns must be project configuration keys
+    int templateColumn = -1;
+    int inputColumn = -1;
+    int outputColumn = -1;
+
+    for (int c = 0; c < manifest.columnCount; c++)
+    {
+        if (strcmp(manifest.columns[c], "TEMPLATE") == 0) templateColumn = c;
+        else if (strcmp(manifest.columns[c], "INPUT") == 0) inputColumn = c;
+        else if (strcmp(manifest.columns[c], "OUTPUT") == 0) outputColumn = c;
+        else if (rpcGetPropertyEntry(config, manifest.columns[c]) == NULL) LOG("WARNING: Batch manifest column is not a project property, ignored: %s\n", manifest.columns[c]);
+    }
+
+    // Project configuration and input buffers, reused for all projects
+    rpcProjectConfig projectConfig = { 0 };
+    projectConfig.capacity = config.capacity;
+    projectConfig.entries = (rpcPropertyEntry *)RL_CALLOC(config.capacity, sizeof(rpcPropertyEntry));
+    rpcProjectInput projectInput = rpcLoadProjectInput();
+    int prevTemplate = -1;
+    char prevInputPaths[1024] = { 0 };
+    bool inputLoaded = false;
+
+    if (parallelCount < 1) parallelCount = 1;
+    GenPlan *plans = (GenPlan *)RL_CALLOC(parallelCount, sizeof(GenPlan));
+    WorkerPool *pool = dryRun? NULL : LoadWorkerPool(generationThreadCount);
+
+    // Plans memory arenas, one per parallel project, reset and reused for next projects
+    MemArena **arenas = (MemArena **)RL_CALLOC(parallelCount, sizeof(MemArena *));
+    for (int p = 0; p < parallelCount; p++) arenas[p] = LoadMemArena(RPC_GEN_ARENA_BLOCK_SIZE);
+    int planCount = 0;
+    int generatedCount = 0;
+
+    for (int i = 0; i < manifest.count; i++)
+    {
+        int templateId = -1;            // Project template, base input used if not defined
+        const char *inputPaths = NULL;  // Project input paths, ';' separated
+        const char *outPath = generationOutPath;
+        char srcPath[512] = { 0 };
+
+        memcpy(projectConfig.entries, config.entries, config.entryCount*sizeof(rpcPropertyEntry));
+        projectConfig.entryCount = config.entryCount;
+
+        if (manifest.cells != NULL)
+        {
+            char **row = &manifest.cells[i*manifest.columnCount];
+
+            for (int c = 0; c < manifest.columnCount; c++)
+            {
+                if ((row[c] == NULL) || (row[c][0] == '\0')) continue;     // Empty cells keep base value
+
+                if (c == templateColumn) templateId = TextToInteger(row[c]);
+                else if (c == inputColumn) inputPaths = row[c];
+                else if (c == outputColumn) outPath = row[c];
+                else SetProjectConfigProperty(projectConfig, manifest.columns[c], row[c]);
+            }
+        }
+        else
+        {
+            // Project configuration file (.rpc) properties override base ones
+            const char *fileName = manifest.configFiles.paths[i];
+
+            int configEvent = BeginProfileEvent("rpcLoadProjectConfig", "input");
+            rpcProjectConfig fileConfig = rpcLoadProjectConfig(fileName);
+            EndProfileEvent(configEvent, GetFileLength(fileName), 0);
+
+            for (int e = 0; e < fileConfig.entryCount; e++) rpcSetPropertyEntry(projectConfig, &fileConfig.entries[e]);
+            rpcUnloadProjectConfig(fileConfig);
+
+            // NOTE: Project source path resolves from .rpc file location, used as input if available
+            const char *sourcePath = rpcGetText(projectConfig, "PROJECT_SOURCE_PATH");
+            if (sourcePath != NULL)
+            {
+                strncpy(srcPath, TextFormat("%s/%s", GetDirectoryPath(fileName), sourcePath), 511);
+                if (DirectoryExists(srcPath)) inputPaths = srcPath;
+            }
+        }
+
+        // Load project input, previous project input reused if same input requested
+        if (!inputLoaded || (templateId != prevTemplate) || !TextIsEqual((inputPaths != NULL)? inputPaths : "", prevInputPaths))
+        {
+            rpcUpdateProjectInput(&projectInput, (inputPaths == NULL)? templateId : 0);
+
+            if (inputPaths != NULL) AddProjectInputPaths(&projectInput, inputPaths, ';');
+            else if (templateId <= 0)
+            {
+                for (int f = 0; f < input.srcFileCount; f++) strcpy(projectInput.srcFilePaths[f], input.srcFilePaths[f]);
+                for (int f = 0; f < input.assetFileCount; f++) strcpy(projectInput.assetFilePaths[f], input.assetFilePaths[f]);
+                projectInput.srcFileCount = input.srcFileCount;
+                projectInput.assetFileCount = input.assetFileCount;
+            }
+
+            prevTemplate = templateId;
+            strncpy(prevInputPaths, (inputPaths != NULL)? inputPaths : "", 1023);
+            inputLoaded = true;
+        }
+
+        if (projectInput.srcFileCount == 0)
+        {
+            LOG("WARNING: Batch project %i: No valid input source files provided and no valid template selected\n", i + 1);
+            continue;
+        }
+
+        plans[planCount] = LoadGenPlan(projectConfig, projectInput, outPath, arenas[planCount]);
+
+        if (!plans[planCount].valid) UnloadGenPlan(&plans[planCount]);
+        else if (dryRun)
+        {
+            LogGenPlanDryRun(&plans[planCount]);
+            UnloadGenPlan(&plans[planCount]);
+            generatedCount++;
+        }
+        else planCount++;
+
+        // Execute planned projects group
+        if (planCount == parallelCount)
+        {
+            ExecuteGenPlans(plans, planCount, pool);
+
+            for (int p = 0; p < planCount; p++) UnloadGenPlan(&plans[p]);
+            generatedCount += planCount;
+            planCount = 0;
+        }
+    }
+
+    // Execute last planned projects group, it could be smaller
+    if (planCount > 0)
+    {
+        ExecuteGenPlans(plans, planCount, pool);
+
+        for (int p = 0; p < planCount; p++) UnloadGenPlan(&plans[p]);
+        generatedCount += planCount;
+    }
+
+    LOG("INFO: Batch generation: %i/%i projects %s\n", generatedCount, manifest.count, dryRun? "planned" : "generated");
+
+    size_t arenasPeakSize = 0;
+    int arenasAllocCount = 0;
+    for (int p = 0; p < parallelCount; p++)
+    {
+        arenasPeakSize += arenas[p]->peakSize;
+        arenasAllocCount += arenas[p]->totalAllocCount;
+        UnloadMemArena(arenas[p]);
+    }
+    RL_FREE(arenas);
+
+    LOG("INFO: Batch generation memory: %i KB peak, %i allocations\n", (int)(arenasPeakSize/1024), arenasAllocCount);
+
+    if (pool != NULL) UnloadWorkerPool(pool);
+    RL_FREE(plans);
+    rpcUnloadProjectInput(projectInput);
+    RL_FREE(projectConfig.entries);
+    UnloadBatchManifest(&manifest);
+}
+#endif // PLATFORM_DESKTOP
+
+//--------------------------------------------------------------------------------------------
+// Load/Save/Export functions
+//--------------------------------------------------------------------------------------------
+// NOTE: rpconfig.h provides required functions, shared by [rpc] and [rpb] tools
+
+//--------------------------------------------------------------------------------------------
+// Auxiliar functions (utilities)
+//--------------------------------------------------------------------------------------------
+
+// Load project source/asset file paths bucket
+static rpcProjectInput rpcLoadProjectInput(void)
+{
+    rpcProjectInput input = { 0 };
+
+    input.srcFilePaths = (char **)RL_CALLOC(RPC_MAX_SOURCE_FILES, sizeof(char *));
+    input.assetFilePaths = (char **)RL_CALLOC(RPC_MAX_ASSET_FILES, sizeof(char *));
+
+    for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) input.srcFilePaths[i] = (char *)RL_CALLOC(RPC_SOURCE_PATH_LENGTH, sizeof(char));
+    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) input.assetFilePaths[i] = (char *)RL_CALLOC(RPC_ASSET_PATH_LENGTH, sizeof(char));
+
+    input.requestedBuildSystems[0] = true;  // Scripts
+    input.requestedBuildSystems[1] = true;  // Makefile
+    input.requestedBuildSystems[2] = true;  // VSCode
+    input.requestedBuildSystems[3] = true;  // VS2022
+    input.requestedBuildSystems[4] = false; // CMake
+    input.requestedBuildSystems[5] = true;  // GitHub Actions
+
+    input.srcFileSelected = (bool *)RL_CALLOC(RPC_MAX_SOURCE_FILES, sizeof(bool));
+    input.assetFileSelected = (bool *)RL_CALLOC(RPC_MAX_ASSET_FILES, sizeof(bool));
+
+    input.assetLookup = (int *)RL_CALLOC(RPC_MAX_ASSET_FILES*2, sizeof(int));
+    input.assetLookupCount = -1;
+
+    return input;
+}
+
+// Unload project source/asset file paths bucket
+static void rpcUnloadProjectInput(rpcProjectInput input)
+{
+    for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) RL_FREE(input.srcFilePaths[i]);
+    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) RL_FREE(input.assetFilePaths[i]);
+
+    RL_FREE(input.srcFilePaths);
+    RL_FREE(input.assetFilePaths);
+    RL_FREE(input.srcFileSelected);
+    RL_FREE(input.assetFileSelected);
+    RL_FREE(input.assetLookup);
+}
+
+// Update input data by selected template
+void rpcUpdateProjectInput(rpcProjectInput *input, int selTemplate)
+{
+    // Clear input data content to refill
+    for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++)
+    {
+        memset(input->srcFilePaths[i], 0, RPC_SOURCE_PATH_LENGTH);
+        input->srcFileSelected[i] = false;
+    }
+    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++)
+    {
+        memset(input->assetFilePaths[i], 0, RPC_ASSET_PATH_LENGTH);
+        input->assetFileSelected[i] = false;
+    }
+    input->srcFileCount = 0;
+    input->assetFileCount = 0;
+    input->assetLookupCount = -1;
+
+    char templatePath[256] = { 0 };
+    // NOTE: [template] directory must be in same directory as [rpc] tool
+    //strcpy(templatePath, TextFormat("%s/template", GetApplicationDirectory()));
+    // WARNING: Instead of copying full template path, assume that the file can be
+    // located in [template] package (next to binary or internal), so no need to specify
+    // a full path; full paths are only used for user-provided files
+    // NOTE: Only paths are set, template archive files are extracted on project generation
+    strcpy(templatePath, "template");
+
+    if (selTemplate == 0)       // Custom
+    {
+        // NOTE: Filled with user provided source files
+        // TODO: Scan required assets and add to the list
+    }
+    else if (selTemplate == 1)  // Basic Window
+    {
         strcpy(input->srcFilePaths[0], TextFormat("%s/src/project_name.c", templatePath));
         input->srcFileCount = 1;
 
-        // No assets required
+        // No assets required
+    }
+    else if (selTemplate == 2)  // Screen Manager
+    {
+        strcpy(input->srcFilePaths[0], TextFormat("%s/src_screen_manager/project_name.c", templatePath));
+        strcpy(input->srcFilePaths[1], TextFormat("%s/src_screen_manager/screens.h", templatePath));
+        strcpy(input->srcFilePaths[2], TextFormat("%s/src_screen_manager/screen_logo.c", templatePath));
+        strcpy(input->srcFilePaths[3], TextFormat("%s/src_screen_manager/screen_title.c", templatePath));
+        strcpy(input->srcFilePaths[4], TextFormat("%s/src_screen_manager/screen_options.c", templatePath));
+        strcpy(input->srcFilePaths[5], TextFormat("%s/src_screen_manager/screen_gameplay.c", templatePath));
+        strcpy(input->srcFilePaths[6], TextFormat("%s/src_screen_manager/screen_ending.c", templatePath));
+        input->srcFileCount = 7;
+
+        strcpy(input->assetFilePaths[0], TextFormat("%s/src_screen_manager/resources/coin.wav", templatePath));
+        strcpy(input->assetFilePaths[1], TextFormat("%s/src_screen_manager/resources/mecha.png", templatePath));
+        strcpy(input->assetFilePaths[2], TextFormat("%s/src_screen_manager/resources/README", templatePath)); // Assets licence
+        input->assetFileCount = 3;
+
+        /*
+        FilePathList pathList = LoadDirectoryFiles(TextFormat("%s/src_screen_manager/resources", templatePath));
+        for (int i = 0; i < pathList.count; i++)
+        {
+            strcpy(input->assetFilePaths[i], pathList.paths[i]);
+            input->assetFileCount++;
+        }
+        UnloadDirectoryFiles(pathList);
+        */
+    }
+    else if (selTemplate == 3)  // Platformer 2D
+    {
+        strcpy(input->srcFilePaths[0], TextFormat("%s/src_platformer_2d/project_name.c", templatePath));
+        input->srcFileCount = 1;
+
+        // No assets required
+    }
+    else if (selTemplate == 4)  // First Person 3D
+    {
+        strcpy(input->srcFilePaths[0], TextFormat("%s/src_first_person_3d/project_name.c", templatePath));
+        input->srcFileCount = 1;
+
+        strcpy(input->assetFilePaths[0], TextFormat("%s/src_first_person_3d/resources/cubicmap.png", templatePath));
+        strcpy(input->assetFilePaths[1], TextFormat("%s/src_first_person_3d/resources/cubicmap_atlas.png", templatePath));
+        input->assetFileCount = 2;
+    }
+    else if (selTemplate == 5)  // raygui Tool
+    {
+        strcpy(input->srcFilePaths[0], TextFormat("%s/src_raygui_tool/project_name.c", templatePath));
+        strcpy(input->srcFilePaths[1], TextFormat("%s/src_raygui_tool/raygui.h", templatePath));
+        strcpy(input->srcFilePaths[2], TextFormat("%s/src_raygui_tool/style_cyber.h", templatePath));
+        strcpy(input->srcFilePaths[3], TextFormat("%s/src_raygui_tool/style_lavanda.h", templatePath));
+        strcpy(input->srcFilePaths[4], TextFormat("%s/src_raygui_tool/style_genesis.h", templatePath));
+        strcpy(input->srcFilePaths[5], TextFormat("%s/src_raygui_tool/style_terminal.h", templatePath));
+        input->srcFileCount = 6;
+
+        // No assets required
+    }
+}
+
+// Add asset file to project input, normalized path, duplicates omitted (returns true if added)
+// NOTE: Assets lookup table is rebuilt if assets list was modified directly (assets count not matching)
+static bool AddProjectInputAsset(rpcProjectInput *input, const char *assetPath)
+{
+    if ((input->assetFileCount >= RPC_MAX_ASSET_FILES) || (strlen(assetPath) >= RPC_ASSET_PATH_LENGTH)) return false;
+
+    // Normalize path: '/' separators, no "./" prefix and no repeated separators (leading "//" kept)
+    char path[RPC_ASSET_PATH_LENGTH] = { 0 };
+    int length = 0;
+
+    while ((assetPath[0] == '.') && ((assetPath[1] == '/') || (assetPath[1] == '\\'))) assetPath += 2;
+
+    for (int i = 0; assetPath[i] != '\0'; i++)
+    {
+        char c = (assetPath[i] == '\\')? '/' : assetPath[i];
+        if ((c == '/') && (length > 1) && (path[length - 1] == '/')) continue;
+        path[length++] = c;
+    }
+
+    if (length == 0) return false;
+
+    if (input->assetLookupCount != input->assetFileCount)
+    {
+        for (int i = 0; i < RPC_MAX_ASSET_FILES*2; i++) input->assetLookup[i] = -1;
+
+        for (int i = 0; i < input->assetFileCount; i++)
+        {
+            const char *filePath = input->assetFilePaths[i];
+            unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)filePath, (int)strlen(filePath)) & (RPC_MAX_ASSET_FILES*2 - 1);
+
+            while (input->assetLookup[slot] >= 0) slot = (slot + 1) & (RPC_MAX_ASSET_FILES*2 - 1);
+            input->assetLookup[slot] = i;
+        }
+
+        input->assetLookupCount = input->assetFileCount;
+    }
+
+    unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)path, length) & (RPC_MAX_ASSET_FILES*2 - 1);
+
+    while (input->assetLookup[slot] >= 0)
+    {
+        if (strcmp(input->assetFilePaths[input->assetLookup[slot]], path) == 0) return false;
+        slot = (slot + 1) & (RPC_MAX_ASSET_FILES*2 - 1);
+    }
+
+    strcpy(input->assetFilePaths[input->assetFileCount], path);
+    input->assetLookup[slot] = input->assetFileCount;
+    input->assetFileCount++;
+    input->assetLookupCount++;
+
+    return true;
+}
+
+// Get asset file kind by file extension: AssetKind
+// NOTE: Extension after last '.' compared case-insensitive, equivalent to IsFileExtension(),
+// extensions table is a perfect hash: one slot probed and compared, no collisions
+// WARNING: Table slots must be recomputed if extensions are added, keeping all slots unique
+static int GetAssetFileKind(const char *fileName)
+{
+    static const AssetExtension assetExtensions[128] = {
+        [0] = { "glb", ASSET_KIND_MODEL }, [3] = { "m3d", ASSET_KIND_MODEL }, [11] = { "pvr", ASSET_KIND_IMAGE },
+        [12] = { "qoa", ASSET_KIND_AUDIO }, [13] = { "flac", ASSET_KIND_AUDIO }, [14] = { "vs", ASSET_KIND_SHADER },
+        [35] = { "dxt", ASSET_KIND_IMAGE }, [36] = { "xm", ASSET_KIND_AUDIO }, [37] = { "gif", ASSET_KIND_IMAGE },
+        [41] = { "hdr", ASSET_KIND_IMAGE }, [42] = { "iqm", ASSET_KIND_MODEL }, [43] = { "astc", ASSET_KIND_IMAGE },
+        [47] = { "mod", ASSET_KIND_AUDIO }, [48] = { "ogg", ASSET_KIND_AUDIO }, [49] = { "h", ASSET_KIND_CODE },
+        [51] = { "txt", ASSET_KIND_TEXT }, [53] = { "gltf", ASSET_KIND_MODEL }, [54] = { "bmp", ASSET_KIND_IMAGE },
+        [55] = { "mp3", ASSET_KIND_AUDIO }, [60] = { "vox", ASSET_KIND_MODEL }, [62] = { "obj", ASSET_KIND_MODEL },
+        [74] = { "ktx", ASSET_KIND_IMAGE }, [84] = { "png", ASSET_KIND_IMAGE }, [88] = { "jpg", ASSET_KIND_IMAGE },
+        [93] = { "wav", ASSET_KIND_AUDIO }, [100] = { "otf", ASSET_KIND_FONT }, [101] = { "raw", ASSET_KIND_IMAGE },
+        [105] = { "ttf", ASSET_KIND_FONT }, [107] = { "c", ASSET_KIND_CODE }, [115] = { "fnt", ASSET_KIND_FONT },
+        [116] = { "qoi", ASSET_KIND_IMAGE }, [126] = { "fs", ASSET_KIND_SHADER },
+    };
+
+    const char *dot = strrchr(fileName, '.');
+    if ((dot == NULL) || (dot == fileName)) return ASSET_KIND_NONE;
+
+    // Lowercase extension, max 4 characters
+    char ext[5] = { 0 };
+    int length = 0;
+    for (dot++; dot[length] != '\0'; length++)
+    {
+        if (length >= 4) return ASSET_KIND_NONE;
+        ext[length] = ((dot[length] >= 'A') && (dot[length] <= 'Z'))? (dot[length] + 32) : dot[length];
+    }
+
+    if (length == 0) return ASSET_KIND_NONE;
+
+    unsigned int slot = ((unsigned char)ext[0] + 5*(unsigned char)ext[1] + 13*(unsigned char)ext[length - 1] + length) & 127;
+
+    if ((assetExtensions[slot].ext != NULL) && (strcmp(assetExtensions[slot].ext, ext) == 0)) return assetExtensions[slot].kind;
+
+    return ASSET_KIND_NONE;
+}
+
+// Scan asset paths from a source code file (raylib)
+// NOTE: Code scanned by ScanSourceAssetPaths(), scan cache asset paths reused if file not changed
+// WARNING: Source files scan must not be in progress, scan cache is shared with worker threads
+static char **LoadSourceAssetPaths(const char *srcFilePath, int *assetCount)
+{
+    #define RPC_MAX_ASSET_FILES     256
+    #define RPC_ASSET_PATH_LENGTH   256
+
+    char **paths = (char **)RL_CALLOC(RPC_MAX_ASSET_FILES, sizeof(char **));
+    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) paths[i] = (char *)RL_CALLOC(RPC_ASSET_PATH_LENGTH, sizeof(char));
+
+    int profileEvent = BeginProfileEvent("LoadSourceAssetPaths", "input");
+    int codeSize = 0;
+
+    int assetCounter = 0;
+
+    LoadScanCache();
+
+    SourceScanFile file = { 0 };
+    file.path = (char *)srcFilePath;
+    file.cacheIndex = GetScanCacheEntryIndex(srcFilePath);
+
+    ScanSourceFile(&file, (file.cacheIndex >= 0)? &scanCache.entries[file.cacheIndex] : NULL);
+
+    if (file.assetPaths != NULL)
+    {
+        const char *assetPath = file.assetPaths;
+
+        for (int i = 0; i < file.assetCount; i++)
+        {
+            strcpy(paths[i], assetPath);
+            assetPath += (strlen(assetPath) + 1);
+        }
+
+        assetCounter = file.assetCount;
+        if (!file.cached) codeSize = file.size;
+
+        SetScanCacheEntry(&file);
+        SaveScanCache();
+
+        RL_FREE(file.assetPaths);
+    }
+
+    // NOTE: Some resources could require linked resources: .fnt --> .png, .obj --> .mtl --> .png, .gltf --> .bin/.png
+    // They are resolved on project generation from assets found, see AddGenLinkedAssets()
+
+    EndProfileEvent(profileEvent, codeSize, 0);
+
+    *assetCount = assetCounter;
+    return paths;
+}
+
+// Clear resource paths scanned
+static void UnloadSourceAssetPaths(char **assetPaths)
+{
+    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) RL_FREE(assetPaths[i]);
+
+    RL_FREE(assetPaths);
+}
+
+// Scan asset paths from source code text, returns paths count
+// NOTE: Code is scanned in a single forward pass by a lightweight C lexer: comments, char literals
+// and #include lines are skipped, string literals are unescaped and adjacent literals concatenated,
+// every literal is classified by the nearest enclosing known call (loading, saving or text function)
+// NOTE: Paths array must provide RPC_MAX_ASSET_FILES strings, no global state used (worker-safe)
+// WARNING: Supported asset file extensions are hardcoded by used file types
+// but new examples could require other file extensions to be added
+static int ScanSourceAssetPaths(const char *code, char **paths)
+{
+    #define RPC_MAX_CALL_DEPTH       64
+
+    int assetCounter = 0;
+
+    int callUsage[RPC_MAX_CALL_DEPTH] = { 0 };  // Enclosing calls usage, innermost call last
+    int callDepth = 0;                          // Enclosing calls depth (could exceed stored calls)
+    const char *ident = NULL;                   // Previous token identifier (NULL if previous token is not an identifier)
+    int identLength = 0;
+    bool lineStart = true;                      // Only whitespace found since line start
+    bool directive = false;                     // Scanning preprocessor directive line
+
+    char path[RPC_ASSET_PATH_LENGTH] = { 0 };   // String literal text, adjacent literals concatenated
+    int pathLength = -1;                        // String literal length (-1 if no string literal pending)
+    int pathUsage = SOURCE_USAGE_LOAD;          // String literal usage, from enclosing calls
+
+    int pathSlots[RPC_MAX_ASSET_FILES*2] = { 0 }; // Asset paths lookup table, paths indices (-1 if empty)
+    for (int i = 0; i < RPC_MAX_ASSET_FILES*2; i++) pathSlots[i] = -1;
+
+    const char *ptr = code;
+
+    while (true)
+    {
+        char c = *ptr;
+
+        // Skip whitespace, line continuations and comments
+        // NOTE: Preprocessor directive line end is considered a token
+        if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\f') || (c == '\v')) { ptr++; continue; }
+        if ((c == '\n') && !directive) { lineStart = true; ptr++; continue; }
+        if ((c == '\\') && (ptr[1] == '\n')) { ptr += 2; continue; }
+        if ((c == '\\') && (ptr[1] == '\r') && (ptr[2] == '\n')) { ptr += 3; continue; }
+        if ((c == '/') && (ptr[1] == '/'))
+        {
+            while ((*ptr != '\0') && (*ptr != '\n')) ptr++;
+            continue;
+        }
+        if ((c == '/') && (ptr[1] == '*'))
+        {
+            const char *commentEnd = strstr(ptr + 2, "*/");
+            ptr = (commentEnd != NULL)? (commentEnd + 2) : (ptr + strlen(ptr));
+            continue;
+        }
+
+        // String literal, appended to pending literal (adjacent literals are concatenated)
+        if (c == '"')
+        {
+            if (pathLength < 0)
+            {
+                // NOTE: Literals out of known calls are considered asset paths (variables, arrays, defines)
+                pathLength = 0;
+                pathUsage = SOURCE_USAGE_LOAD;
+
+                for (int i = ((callDepth < RPC_MAX_CALL_DEPTH)? callDepth : RPC_MAX_CALL_DEPTH) - 1; i >= 0; i--)
+                {
+                    if (callUsage[i] != SOURCE_USAGE_UNKNOWN) { pathUsage = callUsage[i]; break; }
+                }
+            }
+
+            ptr++;
+            while ((*ptr != '\0') && (*ptr != '"') && (*ptr != '\n'))
+            {
+                char ch = *ptr++;
+
+                if (ch == '\\')
+                {
+                    ch = *ptr;
+                    if (ch == '\0') break;
+                    ptr++;
+
+                    if (ch == '\n') continue;   // Line continuation
+                    else if (ch == 'n') ch = '\n';
+                    else if (ch == 't') ch = '\t';
+                    else if (ch == 'r') ch = '\r';
+                }
+
+                if (pathLength < RPC_ASSET_PATH_LENGTH) path[pathLength] = ch;
+                pathLength++;
+            }
+
+            if (*ptr == '"') ptr++;
+
+            ident = NULL;
+            lineStart = false;
+            continue;
+        }
+
+        // Any other token ends pending string literal, added if it is a loaded asset path
+        if (pathLength >= 0)
+        {
+            if ((pathLength > 0) && (pathLength < RPC_ASSET_PATH_LENGTH) && (pathUsage == SOURCE_USAGE_LOAD))
+            {
+                path[pathLength] = '\0';
+
+                // TODO: WARNING: The path obtained could be relative to srcFilePath or
+                // relative to expected build output, it must be copied to expected build output path
+                // So, asset src path could require compute and validation
+                if (GetAssetFileKind(path) > ASSET_KIND_CODE) assetCounter = AddSourceAssetPath(paths, assetCounter, pathSlots, path);
+            }
+
+            pathLength = -1;
+        }
+
+        if (c == '\0') break;
+
+        if (c == '\n')
+        {
+            // Preprocessor directive end, calls context reset
+            directive = false;
+            callDepth = 0;
+            ident = NULL;
+            lineStart = true;
+            ptr++;
+            continue;
+        }
+        else if ((c == '#') && lineStart)
+        {
+            // Preprocessor directive, #include lines skipped (included headers are not assets)
+            const char *name = ptr + 1;
+            while ((*name == ' ') || (*name == '\t')) name++;
+
+            if (strncmp(name, "include", 7) == 0) while ((*ptr != '\0') && (*ptr != '\n')) ptr++;
+            else
+            {
+                directive = true;
+                callDepth = 0;
+                ptr++;
+            }
+
+            ident = NULL;
+        }
+        else if (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_'))
+        {
+            // Identifier, kept in case it is a called function name
+            ident = ptr;
+            while (((*ptr >= 'a') && (*ptr <= 'z')) || ((*ptr >= 'A') && (*ptr <= 'Z')) ||
+                   ((*ptr >= '0') && (*ptr <= '9')) || (*ptr == '_')) ptr++;
+            identLength = (int)(ptr - ident);
+        }
+        else if ((c >= '0') && (c <= '9'))
+        {
+            // Number, including suffixes and decimals
+            while (((*ptr >= 'a') && (*ptr <= 'z')) || ((*ptr >= 'A') && (*ptr <= 'Z')) ||
+                   ((*ptr >= '0') && (*ptr <= '9')) || (*ptr == '_') || (*ptr == '.')) ptr++;
+            ident = NULL;
+        }
+        else if (c == '\'')
+        {
+            // Char literal, skipped
+            ptr++;
+            while ((*ptr != '\0') && (*ptr != '\'') && (*ptr != '\n'))
+            {
+                if ((*ptr == '\\') && (ptr[1] != '\0')) ptr++;
+                ptr++;
+            }
+            if (*ptr == '\'') ptr++;
+            ident = NULL;
+        }
+        else
+        {
+            // Punctuation, calls context tracking
+            // NOTE: Parenthesis not preceded by identifier are considered grouping (unknown usage)
+            if (c == '(')
+            {
+                int usage = (ident != NULL)? GetSourceFunctionUsage(ident, identLength) : SOURCE_USAGE_UNKNOWN;
+
+                if (callDepth < RPC_MAX_CALL_DEPTH) callUsage[callDepth] = usage;
+                callDepth++;
+            }
+            else if (c == ')') { if (callDepth > 0) callDepth--; }
+            else if ((c == ';') || (c == '{') || (c == '}')) callDepth = 0;
+
+            ident = NULL;
+            ptr++;
+        }
+
+        lineStart = false;
+    }
+
+    return assetCounter;
+}
+
+// Get source function asset usage: SourceUsage
+// NOTE: Only functions receiving file paths or text are registered, unknown functions are
+// not classified, string literals usage is defined by their nearest enclosing known call
+static int GetSourceFunctionUsage(const char *name, int nameLength)
+{
+    static const SourceFunction functions[] = {
+        // Asset loading functions
+        { "LoadImage", SOURCE_USAGE_LOAD }, { "LoadImageRaw", SOURCE_USAGE_LOAD }, { "LoadImageAnim", SOURCE_USAGE_LOAD },
+        { "LoadTexture", SOURCE_USAGE_LOAD }, { "LoadFont", SOURCE_USAGE_LOAD }, { "LoadFontEx", SOURCE_USAGE_LOAD },
+        { "LoadWave", SOURCE_USAGE_LOAD }, { "LoadSound", SOURCE_USAGE_LOAD }, { "LoadMusicStream", SOURCE_USAGE_LOAD },
+        { "LoadModel", SOURCE_USAGE_LOAD }, { "LoadModelAnimations", SOURCE_USAGE_LOAD }, { "LoadMaterials", SOURCE_USAGE_LOAD },
+        { "LoadShader", SOURCE_USAGE_LOAD }, { "LoadFileData", SOURCE_USAGE_LOAD }, { "LoadFileText", SOURCE_USAGE_LOAD },
+        { "FileExists", SOURCE_USAGE_LOAD }, { "GuiLoadStyle", SOURCE_USAGE_LOAD },
+
+        // File saving functions
+        { "ExportImage", SOURCE_USAGE_SAVE }, { "ExportImageAsCode", SOURCE_USAGE_SAVE }, { "ExportImageToMemory", SOURCE_USAGE_SAVE },
+        { "ExportWave", SOURCE_USAGE_SAVE }, { "ExportWaveAsCode", SOURCE_USAGE_SAVE }, { "ExportMesh", SOURCE_USAGE_SAVE },
+        { "ExportMeshAsCode", SOURCE_USAGE_SAVE }, { "ExportFontAsCode", SOURCE_USAGE_SAVE }, { "ExportDataAsCode", SOURCE_USAGE_SAVE },
+        { "ExportAutomationEventList", SOURCE_USAGE_SAVE }, { "TakeScreenshot", SOURCE_USAGE_SAVE },
+        { "SaveFileData", SOURCE_USAGE_SAVE }, { "SaveFileText", SOURCE_USAGE_SAVE }, { "GuiSaveStyle", SOURCE_USAGE_SAVE },
+
+        // Text functions, string literals are formats, messages or file types
+        { "TraceLog", SOURCE_USAGE_TEXT }, { "TextFormat", SOURCE_USAGE_TEXT }, { "DrawText", SOURCE_USAGE_TEXT },
+        { "DrawTextEx", SOURCE_USAGE_TEXT }, { "DrawTextPro", SOURCE_USAGE_TEXT }, { "MeasureText", SOURCE_USAGE_TEXT },
+        { "MeasureTextEx", SOURCE_USAGE_TEXT }, { "SetWindowTitle", SOURCE_USAGE_TEXT }, { "IsFileExtension", SOURCE_USAGE_TEXT },
+        { "LoadImageFromMemory", SOURCE_USAGE_TEXT }, { "LoadWaveFromMemory", SOURCE_USAGE_TEXT }, { "LoadMusicStreamFromMemory", SOURCE_USAGE_TEXT },
+        { "LoadFontFromMemory", SOURCE_USAGE_TEXT }, { "printf", SOURCE_USAGE_TEXT }, { "fprintf", SOURCE_USAGE_TEXT },
+        { "sprintf", SOURCE_USAGE_TEXT }, { "snprintf", SOURCE_USAGE_TEXT }, { "puts", SOURCE_USAGE_TEXT },
+    };
+
+    for (int i = 0; i < (int)(sizeof(functions)/sizeof(SourceFunction)); i++)
+    {
+        if ((strncmp(functions[i].name, name, nameLength) == 0) && (functions[i].name[nameLength] == '\0')) return functions[i].usage;
+    }
+
+    return SOURCE_USAGE_UNKNOWN;
+}
+
+// Add asset path scanned, duplicates omitted (returns paths count)
+// NOTE: Paths lookup table slots (RPC_MAX_ASSET_FILES*2) indexed by path hash, linear probing
+static int AddSourceAssetPath(char **paths, int count, int *slots, const char *path)
+{
+    unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)path, (int)strlen(path)) & (RPC_MAX_ASSET_FILES*2 - 1);
+
+    while (slots[slot] >= 0)
+    {
+        if (strcmp(paths[slots[slot]], path) == 0) return count;
+        slot = (slot + 1) & (RPC_MAX_ASSET_FILES*2 - 1);
+    }
+
+    if (count < RPC_MAX_ASSET_FILES)
+    {
+        strcpy(paths[count], path);
+        slots[slot] = count;
+        count++;
+    }
+
+    return count;
+}
+
+// Add source file to assets scan, scanned when started
+// WARNING: Previous scan must be finished (FinishSourceScan())
+static void AddSourceScanFile(SourceScan *scan, const char *filePath)
+{
+    if (scan->fileCount >= scan->fileCapacity)
+    {
+        scan->fileCapacity = (scan->fileCapacity > 0)? scan->fileCapacity*2 : 64;
+        scan->files = (SourceScanFile *)RL_REALLOC(scan->files, scan->fileCapacity*sizeof(SourceScanFile));
+    }
+
+    SourceScanFile *file = &scan->files[scan->fileCount];
+    memset(file, 0, sizeof(SourceScanFile));
+    file->path = TextCopyAlloc(filePath);
+    file->cacheIndex = -1;
+    scan->fileCount++;
+}
+
+// Start source files assets scan on worker threads (non-blocking)
+// NOTE: Scan cache entries looked up on main thread, without worker threads (web) files are scanned before returning
+static void StartSourceScan(SourceScan *scan)
+{
+    if ((scan->pool != NULL) || (scan->fileCount == 0)) return;
+
+    LoadScanCache();
+    for (int i = 0; i < scan->fileCount; i++) scan->files[i].cacheIndex = GetScanCacheEntryIndex(scan->files[i].path);
+
+    scan->pool = LoadWorkerPool(generationThreadCount);
+    RunWorkerTasks(scan->pool, ProcessSourceScanTask, scan, scan->fileCount);
+}
+
+// Update source files assets scan, finished when all files scanned
+static void UpdateSourceScan(SourceScan *scan, rpcProjectInput *input)
+{
+    if ((scan->pool != NULL) && (GetWorkerTasksCompleted(scan->pool) >= scan->fileCount)) FinishSourceScan(scan, input);
+}
+
+// Finish source files assets scan, waiting for pending files, asset paths merged into project input
+// NOTE: Asset paths already available in project input are omitted, scan cache updated and saved
+static void FinishSourceScan(SourceScan *scan, rpcProjectInput *input)
+{
+    if (scan->pool == NULL) StartSourceScan(scan);
+    if (scan->pool == NULL) return;
+
+    WaitWorkerTasks(scan->pool);
+    UnloadWorkerPool(scan->pool);
+
+    int addedCount = 0;
+    int cachedCount = 0;
+
+    for (int i = 0; i < scan->fileCount; i++)
+    {
+        SourceScanFile *file = &scan->files[i];
+        const char *assetPath = file->assetPaths;
+
+        for (int a = 0; a < file->assetCount; a++)
+        {
+            // TODO: WARNING: Assets should be validated if they exist, adjusting src path if required
+            if (AddProjectInputAsset(input, assetPath)) addedCount++;
+
+            assetPath += (strlen(assetPath) + 1);
+        }
+
+        if (file->assetPaths != NULL) SetScanCacheEntry(file);
+        if (file->cached) cachedCount++;
+
+        RL_FREE(file->assetPaths);
+        RL_FREE(file->path);
+    }
+
+    SaveScanCache();
+
+    LOG("INFO: Source files scanned: %i files (%i cached), %i assets added\n", scan->fileCount, cachedCount, addedCount);
+
+    RL_FREE(scan->files);
+    memset(scan, 0, sizeof(SourceScan));
+}
+
+// Process source file assets scan, worker task callback
+static void ProcessSourceScanTask(void *userData, int index)
+{
+    SourceScan *scan = (SourceScan *)userData;
+    SourceScanFile *file = &scan->files[index];
+
+    ScanSourceFile(file, (file->cacheIndex >= 0)? &scanCache.entries[file->cacheIndex] : NULL);
+}
+
+// Scan source file asset paths, cache entry reused if file not changed (worker-safe)
+// NOTE: Source file is not loaded if size and modification time match cache entry,
+// lexing is skipped if text hash matches cache entry (file saved but not modified)
+// NOTE: Scanned asset paths stored consecutive, scan buffer is only required while scanning
+static void ScanSourceFile(SourceScanFile *file, const ScanCacheEntry *entry)
+{
+    file->size = GetFileLength(file->path);
+    file->modTime = GetFileModTime(file->path);
+
+    if ((entry != NULL) && (entry->size == file->size) && (entry->modTime == file->modTime))
+    {
+        file->hash = entry->hash;
+        file->cached = true;
+    }
+    else
+    {
+        char *code = LoadFileText(file->path);
+
+        if (code != NULL)
+        {
+            file->hash = ComputeHashFNV64((const unsigned char *)code, (int)strlen(code));
+
+            if ((entry != NULL) && (entry->hash == file->hash)) file->cached = true;
+            else
+            {
+                char *pathsData = (char *)RL_CALLOC(RPC_MAX_ASSET_FILES*RPC_ASSET_PATH_LENGTH, sizeof(char));
+                char *paths[RPC_MAX_ASSET_FILES] = { 0 };
+                for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) paths[i] = pathsData + i*RPC_ASSET_PATH_LENGTH;
+
+                file->assetCount = ScanSourceAssetPaths(code, paths);
+
+                file->assetPathsSize = 0;
+                for (int i = 0; i < file->assetCount; i++) file->assetPathsSize += ((int)strlen(paths[i]) + 1);
+
+                file->assetPaths = (char *)RL_MALLOC((file->assetPathsSize > 0)? file->assetPathsSize : 1);
+                for (int i = 0, offset = 0; i < file->assetCount; i++)
+                {
+                    int length = (int)strlen(paths[i]) + 1;
+                    memcpy(file->assetPaths + offset, paths[i], length);
+                    offset += length;
+                }
+
+                RL_FREE(pathsData);
+            }
+
+            UnloadFileText(code);
+        }
+    }
+
+    if (file->cached)
+    {
+        file->assetPathsSize = entry->assetPathsSize;
+        file->assetCount = entry->assetCount;
+        file->assetPaths = (char *)RL_MALLOC((entry->assetPathsSize > 0)? entry->assetPathsSize : 1);
+        if (entry->assetPathsSize > 0) memcpy(file->assetPaths, entry->assetPaths, entry->assetPathsSize);
+    }
+}
+
+// Load source files scan cache from application directory (once)
+// NOTE: Scan cache file is validated, entries after first inconsistent record are omitted
+static void LoadScanCache(void)
+{
+    if (scanCache.loaded) return;
+    scanCache.loaded = true;
+
+#if !defined(PLATFORM_WEB)
+    const char *fileName = TextFormat("%s/%s", GetApplicationDirectory(), RPC_SCAN_CACHE_FILENAME);
+    int dataSize = 0;
+    unsigned char *data = FileExists(fileName)? LoadFileData(fileName, &dataSize) : NULL;
+
+    if (data != NULL)
+    {
+        ScanCacheHeader header = { 0 };
+        if (dataSize >= (int)sizeof(ScanCacheHeader)) memcpy(&header, data, sizeof(ScanCacheHeader));
+
+        if ((memcmp(header.fourcc, "rpcs", 4) == 0) && (header.version == RPC_SCAN_CACHE_VERSION) &&
+            (header.entryCount > 0) && (header.entryCount <= RPC_MAX_SCAN_CACHE_ENTRIES))
+        {
+            int offset = sizeof(ScanCacheHeader);
+
+            scanCache.capacity = header.entryCount;
+            scanCache.entries = (ScanCacheEntry *)RL_CALLOC(scanCache.capacity, sizeof(ScanCacheEntry));
+            scanCache.useStamp = header.useStamp;
+
+            for (int i = 0; i < header.entryCount; i++)
+            {
+                ScanCacheRecord record = { 0 };
+                if ((dataSize - offset) < (int)sizeof(ScanCacheRecord)) break;
+
+                memcpy(&record, data + offset, sizeof(ScanCacheRecord));
+                offset += sizeof(ScanCacheRecord);
+
+                if ((record.pathSize <= 0) || (record.pathSize > RPC_MAX_PATH_LENGTH) || (record.assetPathsSize < 0) ||
+                    (record.assetCount < 0) || (record.assetCount > RPC_MAX_ASSET_FILES) ||
+                    ((dataSize - offset - record.pathSize) < record.assetPathsSize) || (data[offset + record.pathSize - 1] != '\0')) break;
+
+                // Check asset paths data contains the expected paths, every path fits project input
+                const char *assetPaths = (const char *)(data + offset + record.pathSize);
+                int assetCount = 0;
+                int assetLength = 0;
+
+                for (int c = 0; c < record.assetPathsSize; c++)
+                {
+                    if (assetPaths[c] == '\0')
+                    {
+                        if ((assetLength == 0) || (assetLength >= RPC_ASSET_PATH_LENGTH)) break;
+                        assetLength = 0;
+                        assetCount++;
+                    }
+                    else assetLength++;
+                }
+
+                if ((assetCount != record.assetCount) || (assetLength != 0)) break;
+
+                ScanCacheEntry *entry = &scanCache.entries[scanCache.count];
+                entry->path = TextCopyAlloc((const char *)(data + offset));
+                entry->size = record.size;
+                entry->modTime = (long)record.modTime;
+                entry->hash = record.hash;
+                entry->lastUse = record.lastUse;
+                entry->assetPathsSize = record.assetPathsSize;
+                entry->assetCount = record.assetCount;
+                entry->assetPaths = (char *)RL_MALLOC((record.assetPathsSize > 0)? record.assetPathsSize : 1);
+                memcpy(entry->assetPaths, assetPaths, record.assetPathsSize);
+                scanCache.count++;
+
+                offset += (record.pathSize + record.assetPathsSize);
+            }
+
+            if (scanCache.count < header.entryCount) LOG("WARNING: Scan cache file not valid, %i/%i entries loaded: %s\n", scanCache.count, header.entryCount, fileName);
+        }
+
+        UnloadFileData(data);
+    }
+#endif
+
+    BuildScanCacheLookup();
+}
+
+// Save source files scan cache if modified, least recently used entries evicted
+// NOTE: Scan cache bounded by entries count and file size, evicted entries also removed from memory
+static void SaveScanCache(void)
+{
+    if (!scanCache.modified) return;
+    scanCache.modified = false;
+
+    // Sort entries by last use, most recent first
+    ScanCacheEntry *entries = (ScanCacheEntry *)RL_MALLOC(((scanCache.count > 0)? scanCache.count : 1)*sizeof(ScanCacheEntry));
+    if (scanCache.count > 0) memcpy(entries, scanCache.entries, scanCache.count*sizeof(ScanCacheEntry));
+    qsort(entries, scanCache.count, sizeof(ScanCacheEntry), CompareScanCacheEntries);
+
+    int saveCount = 0;
+    int saveSize = sizeof(ScanCacheHeader);
+
+    for (; (saveCount < scanCache.count) && (saveCount < RPC_MAX_SCAN_CACHE_ENTRIES); saveCount++)
+    {
+        int entrySize = sizeof(ScanCacheRecord) + (int)strlen(entries[saveCount].path) + 1 + entries[saveCount].assetPathsSize;
+        if ((saveSize + entrySize) > RPC_MAX_SCAN_CACHE_SIZE) break;
+        saveSize += entrySize;
+    }
+
+    // Evict least recently used entries
+    for (int i = saveCount; i < scanCache.count; i++)
+    {
+        RL_FREE(entries[i].path);
+        RL_FREE(entries[i].assetPaths);
+    }
+
+    RL_FREE(scanCache.entries);
+    scanCache.entries = entries;
+    scanCache.count = saveCount;
+    scanCache.capacity = (saveCount > 0)? saveCount : 1;
+    BuildScanCacheLookup();
+
+#if !defined(PLATFORM_WEB)
+    const char *fileName = TextFormat("%s/%s", GetApplicationDirectory(), RPC_SCAN_CACHE_FILENAME);
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
+    {
+        ScanCacheHeader header = { 0 };
+        memcpy(header.fourcc, "rpcs", 4);
+        header.version = RPC_SCAN_CACHE_VERSION;
+        header.entryCount = scanCache.count;
+        header.useStamp = scanCache.useStamp;
+        fwrite(&header, sizeof(ScanCacheHeader), 1, file);
+
+        for (int i = 0; i < scanCache.count; i++)
+        {
+            const ScanCacheEntry *entry = &scanCache.entries[i];
+            ScanCacheRecord record = { 0 };
+
+            record.hash = entry->hash;
+            record.modTime = entry->modTime;
+            record.lastUse = entry->lastUse;
+            record.size = entry->size;
+            record.pathSize = (int)strlen(entry->path) + 1;
+            record.assetPathsSize = entry->assetPathsSize;
+            record.assetCount = entry->assetCount;
+
+            fwrite(&record, sizeof(ScanCacheRecord), 1, file);
+            fwrite(entry->path, 1, record.pathSize, file);
+            if (entry->assetPathsSize > 0) fwrite(entry->assetPaths, 1, entry->assetPathsSize, file);
+        }
+
+        fclose(file);
+    }
+    else LOG("WARNING: Scan cache file could not be saved: %s\n", fileName);
+#endif
+}
+
+// Unload source files scan cache
+static void UnloadScanCache(void)
+{
+    for (int i = 0; i < scanCache.count; i++)
+    {
+        RL_FREE(scanCache.entries[i].path);
+        RL_FREE(scanCache.entries[i].assetPaths);
+    }
+
+    RL_FREE(scanCache.entries);
+    RL_FREE(scanCache.lookup);
+
+    memset(&scanCache, 0, sizeof(ScanCache));
+}
+
+// Get scan cache entry index for source file path (-1 if not found)
+static int GetScanCacheEntryIndex(const char *path)
+{
+    if (scanCache.count == 0) return -1;
+
+    unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)path, (int)strlen(path)) & (scanCache.lookupSize - 1);
+
+    while (scanCache.lookup[slot] != -1)
+    {
+        if (strcmp(scanCache.entries[scanCache.lookup[slot]].path, path) == 0) return scanCache.lookup[slot];
+
+        slot = (slot + 1) & (scanCache.lookupSize - 1);
+    }
+
+    return -1;
+}
+
+// Set scan cache entry from source file scanned, entry added if required
+// NOTE: Entry last use stamp is updated, asset paths reused from entry are not copied again
+static void SetScanCacheEntry(const SourceScanFile *file)
+{
+    int index = GetScanCacheEntryIndex(file->path);
+
+    if (index < 0)
+    {
+        if (scanCache.count >= scanCache.capacity)
+        {
+            scanCache.capacity = (scanCache.capacity > 0)? scanCache.capacity*2 : 64;
+            scanCache.entries = (ScanCacheEntry *)RL_REALLOC(scanCache.entries, scanCache.capacity*sizeof(ScanCacheEntry));
+        }
+
+        index = scanCache.count;
+        memset(&scanCache.entries[index], 0, sizeof(ScanCacheEntry));
+        scanCache.entries[index].path = TextCopyAlloc(file->path);
+        scanCache.count++;
+
+        if ((scanCache.count*2) > scanCache.lookupSize) BuildScanCacheLookup();
+        else
+        {
+            unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)file->path, (int)strlen(file->path)) & (scanCache.lookupSize - 1);
+
+            while (scanCache.lookup[slot] != -1) slot = (slot + 1) & (scanCache.lookupSize - 1);
+            scanCache.lookup[slot] = index;
+        }
+    }
+
+    ScanCacheEntry *entry = &scanCache.entries[index];
+
+    // NOTE: Files modified on scan time second could be modified again without time change,
+    // modification time is not registered for them, so text hash is checked on next scan
+    entry->hash = file->hash;
+    entry->size = file->size;
+    entry->modTime = ((long)time(NULL) > (file->modTime + 1))? file->modTime : 0;
+    entry->lastUse = ++scanCache.useStamp;
+
+    if (!file->cached)
+    {
+        RL_FREE(entry->assetPaths);
+        entry->assetPaths = (char *)RL_MALLOC((file->assetPathsSize > 0)? file->assetPathsSize : 1);
+        if (file->assetPathsSize > 0) memcpy(entry->assetPaths, file->assetPaths, file->assetPathsSize);
+        entry->assetPathsSize = file->assetPathsSize;
+        entry->assetCount = file->assetCount;
+    }
+
+    scanCache.modified = true;
+}
+
+// Build scan cache entries lookup table by source file path
+// NOTE: Open addressing with linear probing, table kept at most half full
+static void BuildScanCacheLookup(void)
+{
+    int lookupSize = 64;
+    while (lookupSize < scanCache.count*2) lookupSize *= 2;
+
+    if (lookupSize != scanCache.lookupSize)
+    {
+        RL_FREE(scanCache.lookup);
+        scanCache.lookup = (int *)RL_MALLOC(lookupSize*sizeof(int));
+        scanCache.lookupSize = lookupSize;
+    }
+
+    for (int i = 0; i < scanCache.lookupSize; i++) scanCache.lookup[i] = -1;
+
+    for (int i = 0; i < scanCache.count; i++)
+    {
+        unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)scanCache.entries[i].path,
+            (int)strlen(scanCache.entries[i].path)) & (scanCache.lookupSize - 1);
+
+        while (scanCache.lookup[slot] != -1) slot = (slot + 1) & (scanCache.lookupSize - 1);
+        scanCache.lookup[slot] = i;
+    }
+}
+
+// Compare scan cache entries by last use, most recent first
+static int CompareScanCacheEntries(const void *a, const void *b)
+{
+    unsigned int lastUseA = ((const ScanCacheEntry *)a)->lastUse;
+    unsigned int lastUseB = ((const ScanCacheEntry *)b)->lastUse;
+
+    return (lastUseA < lastUseB)? 1 : ((lastUseA > lastUseB)? -1 : 0);
+}
+
+// Load project generation plan, no output is written
+// NOTE: Plan contains all jobs required to generate the project, executed by ExecuteGenPlan()
+// Project input files required to update:
+//  - src/project_name.c
+//  - src/project_name.rc
+//  - src/project_name.ico
+//  - src/project_name.icns
+//  - src/Info.plist
+//  - src/minshell.html
+//  - src/Makefile
+//  - projects/scripts/*
+//  - projects/VS2022/*
+//  - projects/VSCode/*
+//  - README.md
+//  - LICENSE
+// NOTE: Plan temporaries and jobs data are allocated from provided arena, a plan arena is loaded if not provided
+static GenPlan LoadGenPlan(rpcProjectConfig project, rpcProjectInput input, const char *outPath, MemArena *arena)
+{
+    GenPlan plan = { 0 };
+    int planEvent = BeginProfileEvent("Generation plan", "plan");
+
+    // Get template directory
+    // TODO: Use embedded template into executable?
+    // NOTE: [template] directory must be in same directory as [rpc] tool
+    PathBuilder templateRoot = { 0 };
+    SetPathRoot(&templateRoot, GetWorkingDirectory(), "template");
+    //SetPathRoot(&templateRoot, GetApplicationDirectory(), "template");
+
+    // Security check to validate required template
+    // NOTE: Template archive (package attached to executable or zip) is used if template directory is not available
+    bool templateArchived = (GetTemplateArchiveIndex("template/project_name.rpc") >= 0);
+
+    if (!templateArchived &&
+        (!DirectoryExists(BuildPath(&templateRoot, NULL)) ||
+         !DirectoryExists(BuildPath(&templateRoot, "src", NULL)) ||
+         !DirectoryExists(BuildPath(&templateRoot, "projects", NULL)) ||
+         !FileExists(BuildPath(&templateRoot, "project_name.rpc", NULL))))
+    {
+        LOG("WARNING: Project generation template required files can not be found\n");
+        EndProfileEvent(planEvent, 0, 0);
+        return plan;
+    }
+
+    // NOTE: Template files are loaded once, shared with previous/next generations
+    SetTemplateCacheRoot(BuildPath(&templateRoot, NULL));
+
+    plan.arenaOwned = (arena == NULL);
+    plan.arena = (arena != NULL)? arena : LoadMemArena(RPC_GEN_ARENA_BLOCK_SIZE);
+    plan.dirJobs.arena = plan.arena;
+    plan.fileJobs.arena = plan.arena;
+
+    // Update raylib src path, OS-dependant:
+    // - Windows: raylib Windows Installer default: C:/raylib/raylib
+    // - Linux: Usually installed in system and widely available
+    // - macOS: Dependant on user placement, default to: $(HOME)/Library/raylib
+    char raylibSrcPath[256] = { 0 };
+#if defined(__linux__)
+    strcpy(raylibSrcPath, ".");
+#elif defined(__FreeBSD__)
+    strcpy(raylibSrcPath, ".");
+#elif defined(__APPLE__)
+    strcpy(raylibSrcPath, "$(HOME)/Library/raylib");
+#else
+    strcpy(raylibSrcPath, rpcGetText(project, "RAYLIB_SRC_PATH"));
+#endif
+
+    char currentYearText[16] = { 0 };
+    strcpy(currentYearText, TextFormat("%i", currentYear));
+
+    LOG("INFO: Starting project generation: %s\n", rpcGetText(project, "PROJECT_REPO_NAME")? rpcGetText(project, "PROJECT_REPO_NAME") : "-");
+
+    if (rpcGetText(project, "PROJECT_REPO_NAME")[0] == '\0') strcpy(rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME"));
+
+    // Get project properties required for output paths, looked up once
+    const char *repoName = rpcGetText(project, "PROJECT_REPO_NAME");
+    const char *internalName = rpcGetText(project, "PROJECT_INTERNAL_NAME");
+    const char *sourcePath = rpcGetText(project, "PROJECT_SOURCE_PATH");
+    const char *assetsPath = rpcGetText(project, "PROJECT_ASSETS_PATH");
+
+    // Get project output root paths: project, sources and assets directories
+    // NOTE: All output paths are built from these roots, no text formatting required
+    PathBuilder projectRoot = { 0 };
+    PathBuilder sourceRoot = { 0 };
+    PathBuilder assetsRoot = { 0 };
+    SetPathRoot(&projectRoot, outPath, repoName);
+    SetPathRoot(&sourceRoot, projectRoot.path, sourcePath);
+    SetPathRoot(&assetsRoot, projectRoot.path, assetsPath);
+
+    LOG("INFO: Output path: %s/%s\n\n", outPath, repoName);
+
+    LOG("INFO: Output project source code path: %s/%s", repoName, sourcePath);
+    LOG("INFO: Input source code files to be added [%i]:\n", input.srcFileCount);
+    for (int i = 0; i < input.srcFileCount; i++) LOG("      [%i/%i] %s\n", i + 1, input.srcFileCount, input.srcFilePaths[i]);
+    LOG("\n");
+    LOG("INFO: Output project assets path: %s/%s", repoName, assetsPath);
+    LOG("INFO: Input asset files to be added [%i]:\n", input.assetFileCount);
+    for (int i = 0; i < input.assetFileCount; i++) LOG("      [%i/%i] %s\n", i + 1, input.assetFileCount, input.assetFilePaths[i]);
+    LOG("\n");
+
+    // Project generation is split into independent jobs, processed by worker threads:
+    //  - Directory jobs: Create all required output directories, processed first (parent-first order)
+    //  - File jobs: Copy and update (render) output files, logging in jobs order
+    // NOTE: Project configuration file (.rpc) is generated on main thread, after directories creation
+    strcpy(plan.projectName, internalName);
+    strcpy(plan.projectOutPath, BuildPath(&projectRoot, NULL));
+
+    BeginGenPlanSection(&plan, "Source files");
+
+    // Project output directory, root of all project directories
+    AddGenDirectory(&plan, plan.projectOutPath);
+
+    // Copy project source file(s) provided
+    //--------------------------------------------------------------------------
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, TextFormat("INFO: Copying input source files to project sources path: %s/%s\n",
+        repoName, sourcePath));
+
+    // Create required output directories (src/external)
+    AddGenDirectory(&plan, BuildPath(&sourceRoot, "external", NULL));
+
+    for (int i = 0; i < input.srcFileCount; i++)
+    {
+        // Get expected destination file path for source input files
+        // NOTE: In case file name contains "project_name", replacing it by user defined project internal name
+        const char *dstFilePath = BuildPath(&sourceRoot, TextReplace(GetFileName(input.srcFilePaths[i]), "project_name", internalName), NULL);
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, input.srcFilePaths[i], dstFilePath,
+            TextFormat("INFO: [%i/%i] Copying: %s\n", i + 1, input.srcFileCount, dstFilePath));
+    }
+
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Copied project source files successfully\n");
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Assets");
+
+    // Copy assets to output resource path (if required)
+    //-------------------------------------------------------------------------------------
+    // Get assets staging mode: COPY (default), LINK (hardlink, symlink if crossing file systems), SYMLINK
+    // NOTE: Linked assets fallback to copy per file if link can not be created, web always copies assets
+    int assetsJobType = GEN_JOB_COPY;
+    const char *assetsLinkMode = rpcGetText(project, "PROJECT_ASSETS_LINK_MODE");
+
+#if !defined(PLATFORM_WEB)
+    if (assetsLinkMode != NULL)
+    {
+        if (TextIsEqual(assetsLinkMode, "LINK")) assetsJobType = GEN_JOB_LINK;
+        else if (TextIsEqual(assetsLinkMode, "SYMLINK")) assetsJobType = GEN_JOB_SYMLINK;
+        else if (!TextIsEqual(assetsLinkMode, "COPY") && (assetsLinkMode[0] != '\0')) LOG("WARNING: Assets link mode not supported, using COPY: %s\n", assetsLinkMode);
+    }
+#endif
+
+    if (input.assetFileCount > 0)
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, TextFormat("INFO: Copying input assets files to project resources path: %s/%s\n",
+            repoName, assetsPath));
+
+        AddGenDirectory(&plan, BuildPath(&assetsRoot, NULL));
+
+        // NOTE: Resources linked by assets (.fnt, .gltf, .obj, .mtl) are also copied, resolved recursively
+        LinkedAssetResolver resolver = LoadLinkedAssetResolver(plan.arena);
+        int linkedEvent = BeginProfileEvent("Linked assets", "plan");
+
+        for (int i = 0; i < input.assetFileCount; i++)
+        {
+            // NOTE: Copy (or link) always with original name, asset file names must be unique
+            const char *fileName = GetFileName(input.assetFilePaths[i]);
+
+            if (!AddLinkedAssetDestination(&resolver, fileName, input.assetFilePaths[i])) continue;
+
+            // Get expected destination file path
+            const char *dstFilePath = BuildPath(&assetsRoot, fileName, NULL);
+
+            AddGenJob(&plan.fileJobs, assetsJobType, input.assetFilePaths[i], dstFilePath,
+                TextFormat("INFO: [%i/%i] %s: %s\n", i + 1, input.assetFileCount, (assetsJobType == GEN_JOB_COPY)? "Copying" : "Linking", dstFilePath));
+
+            AddGenLinkedAssets(&plan, &resolver, &assetsRoot, input.assetFilePaths[i], fileName, assetsJobType, 0);
+        }
+
+        EndProfileEvent(linkedEvent, resolver.bytesRead, 0);
+        if (resolver.linkedCount > 0) AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, TextFormat("INFO: Linked asset files added: %i\n", resolver.linkedCount));
+        UnloadLinkedAssetResolver(&resolver);
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Copied project asset files successfully\n");
+    }
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    int configSection = plan.sectionCount;
+    BeginGenPlanSection(&plan, "Project config (.rpc)");
+
+    // Project configuration file (.rpc)
+    // NOTE: This file can be used by [rpb] to build the project, it is generated on main thread
+    //-------------------------------------------------------------------------------------
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, TextFormat("INFO: Generating project config file (.rpc): %s/%s.rpc\n",
+        repoName, internalName));
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Project config file (.rpc) generated successfully\n");
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Build system: Scripts");
+
+    // Project build system: Scripts
+    //-------------------------------------------------------------------------------------
+    if (input.requestedBuildSystems[0])
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generating build system: scripts (.bat, .sh)\n");
+
+        // Create required output directories
+        AddGenDirectory(&plan, BuildPath(&projectRoot, "projects/scripts", NULL));
+
+        // Update src/build.bat (Windows only)
+        // TODO: Use CMD/Shell calls directly, current script uses Makefile
+        TextReplacement scriptReplacements[] = {
+            { "project_name", internalName },
+            { "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION") },
+            { "C:\\raylib\\w64devkit\\bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH") },
+        };
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "projects/scripts/build.bat", NULL),
+            BuildPath(&projectRoot, "projects/scripts/build.bat", NULL),
+            scriptReplacements, sizeof(scriptReplacements)/sizeof(TextReplacement));
+
+        // TODO: Add .sh build script
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Build system generated successfully: scripts (.bat, .sh)\n");
+    }
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Build system: Makefile");
+
+    // Project build system: Makefile
+    //-------------------------------------------------------------------------------------
+    if (input.requestedBuildSystems[1])
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generating build system: Makefile\n");
+
+        // Get names for the input source paths (only filename, without path)
+        // NOTE: Names are allocated from plan arena, released with plan
+        char **srcFileNames = (char **)MemArenaAlloc(plan.arena, (input.srcFileCount + 1)*sizeof(char *));
+        srcFileNames[0] = MemArenaCopyText(plan.arena, "");
+
+        int srcFileCount = 0;
+        for (int j = 0; j < input.srcFileCount; j++)
+        {
+            if (IsFileExtension(input.srcFilePaths[j], ".c"))
+            {
+                // TODO: WARNING: Some code files could be inside a directory structure,
+                // but on copy it will be eliminated
+                srcFileNames[srcFileCount] = MemArenaCopyText(plan.arena, GetFileName(input.srcFilePaths[j]));
+                srcFileCount++;
+            }
+        }
+
+        // Update src/Makefile
+        // Add all project required sources concatenated
+        TextReplacement makefileReplacements[] = {
+            { "project_name.c", TextJoin(srcFileNames, srcFileCount, " ") },
+            { "project_name", internalName },
+            { "C:\\raylib\\w64devkit\\bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH") },
+            { "C:/raylib/raylib/src", raylibSrcPath },
+            // If project includes resources, update Makefile required lines
+            // TODO: Update also resources path for building?: "BUILD_WEB_RESOURCES_PATH ?= resources"
+            { "BUILD_WEB_RESOURCES   ?= FALSE", "BUILD_WEB_RESOURCES   ?= TRUE" },
+        };
+        int makefileReplacementCount = sizeof(makefileReplacements)/sizeof(TextReplacement);
+        if (input.assetFileCount == 0) makefileReplacementCount--; // No resources, keep BUILD_WEB_RESOURCES unchanged
+
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "src/Makefile", NULL),
+            BuildPath(&sourceRoot, "Makefile", NULL),
+            makefileReplacements, makefileReplacementCount);
+
+        // Add Makefile.Android for Android APK building target
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "src/Makefile.Android", NULL),
+            BuildPath(&sourceRoot, "Makefile.Android", NULL), NULL);
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Build system generated successfully: Makefile\n");
+    }
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Build system: VSCode");
+
+    // Project build system: VSCode
+    //-------------------------------------------------------------------------------------
+    if (input.requestedBuildSystems[2])
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generating build system: VSCode\n");
+
+        // Create required output directories
+        AddGenDirectory(&plan, BuildPath(&projectRoot, "projects/VSCode/.vscode", NULL));
+
+        // Update projects/VSCode/.vscode/launch.json
+        TextReplacement launchReplacements[] = {
+            { "project_name", internalName },
+            { "C:\\raylib\\w64devkit\\bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH") },
+        };
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "projects/VSCode/.vscode/launch.json", NULL),
+            BuildPath(&projectRoot, "projects/VSCode/.vscode/launch.json", NULL),
+            launchReplacements, sizeof(launchReplacements)/sizeof(TextReplacement));
+
+        // Update projects/VSCode/.vscode/c_cpp_properties.json
+        TextReplacement propertiesReplacements[] = {
+            { "C:/raylib/raylib/src", raylibSrcPath },
+            { "C:/raylib/w64devkit/bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH") },
+        };
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "projects/VSCode/.vscode/c_cpp_properties.json", NULL),
+            BuildPath(&projectRoot, "projects/VSCode/.vscode/c_cpp_properties.json", NULL),
+            propertiesReplacements, sizeof(propertiesReplacements)/sizeof(TextReplacement));
+
+        // Update projects/VSCode/.vscode/tasks.json
+        TextReplacement tasksReplacements[] = {
+            { "C:/raylib/raylib/src", raylibSrcPath },
+        };
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "projects/VSCode/.vscode/tasks.json", NULL),
+            BuildPath(&projectRoot, "projects/VSCode/.vscode/tasks.json", NULL),
+            tasksReplacements, sizeof(tasksReplacements)/sizeof(TextReplacement));
+
+        // Copy projects/VSCode/.vscode/settings.json
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "projects/VSCode/.vscode/settings.json", NULL),
+            BuildPath(&projectRoot, "projects/VSCode/.vscode/settings.json", NULL), NULL);
+
+        // Copy projects/VSCode/main.code-workspace
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "projects/VSCode/main.code-workspace", NULL),
+            BuildPath(&projectRoot, "projects/VSCode/main.code-workspace", NULL), NULL);
+
+        // Copy projects/VSCode/README.md
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "projects/VSCode/README.md", NULL),
+            BuildPath(&projectRoot, "projects/VSCode/README.md", NULL), NULL);
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Build system generated successfully: VSCode\n");
+    }
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Build system: VS2022");
+
+    // Project build system: VS2022
+    //-------------------------------------------------------------------------------------
+    if (input.requestedBuildSystems[3])
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generating build system: Visual Studio 2022\n");
+
+        // Create required output directories
+        AddGenDirectory(&plan, BuildPath(&projectRoot, "projects/VS2022/raylib", NULL));
+        AddGenDirectory(&plan, BuildPath(&projectRoot, "projects/VS2022/", internalName, NULL));
+
+        // Copy projects/VS2022/raylib/raylib.vcxproj
+        TextReplacement raylibProjectReplacements[] = {
+            { "C:\\raylib\\raylib\\src", raylibSrcPath },
+        };
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "projects/VS2022/raylib/raylib.vcxproj", NULL),
+            BuildPath(&projectRoot, "projects/VS2022/raylib/raylib.vcxproj", NULL),
+            raylibProjectReplacements, sizeof(raylibProjectReplacements)/sizeof(TextReplacement));
+
+        // Copy projects/VS2022/raylib/Directory.Build.props
+        //AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "projects/VS2022/raylib/Directory.Build.props", NULL),
+        //    BuildPath(&projectRoot, "projects/VS2022/raylib/Directory.Build.props", NULL), NULL);
+
+        // Update projects/VS2022/project_name/config->project_name.vcproj
+        // Get names for the input source paths (only filename, without path)
+        // NOTE: Names are allocated from plan arena, released with plan
+        char **srcFileNames = (char **)MemArenaAlloc(plan.arena, (input.srcFileCount + 1)*sizeof(char *));
+        srcFileNames[0] = MemArenaCopyText(plan.arena, "");
+
+        int srcFileCount = 0;
+        for (int j = 0; j < input.srcFileCount; j++)
+        {
+            if (IsFileExtension(input.srcFilePaths[j], ".c"))
+            {
+                // TODO: WARNING: Some code files could be inside a directory structure,
+                // but on copy it will be eliminated
+                srcFileNames[srcFileCount] = MemArenaCopyText(plan.arena, GetFileName(input.srcFilePaths[j]));
+                srcFileCount++;
+            }
+        }
+
+        // Add all project required sources concatenated
+        char srcFilesBlock[1024] = { 0 };
+        int nextPosition = 0;
+        for (int k = 1; k < srcFileCount; k++)
+        {
+            TextAppend(srcFilesBlock, TextFormat("<ClCompile Include=\"..\\..\\..\\%s\\%s\" />\n    ",
+                sourcePath, srcFileNames[k]), &nextPosition);
+        }
+
+        TextReplacement vsProjectReplacements[] = {
+            { "project_name.c", srcFileNames[0] }, // TODO: Main source code file
+            { "<!--Additional Compile Items-->", srcFilesBlock },
+            { "project_name", internalName },
+            { "C:\\raylib\\raylib\\src", raylibSrcPath },
+        };
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "projects/VS2022/project_name/project_name.vcxproj", NULL),
+            BuildPath(&projectRoot, "projects/VS2022/", internalName, "/", internalName, ".vcxproj", NULL),
+            vsProjectReplacements, sizeof(vsProjectReplacements)/sizeof(TextReplacement));
+
+        // Copy user file to set working directory to src path, so resources can be found
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "projects/VS2022/project_name/project_name.vcxproj.user", NULL),
+            BuildPath(&projectRoot, "projects/VS2022/", internalName, "/", internalName, ".vcxproj.user", NULL), NULL);
+
+        // Update projects/VS2022/project_name.sln
+        TextReplacement vsSolutionReplacements[] = {
+            { "project_name", internalName },
+        };
+        AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "projects/VS2022/project_name.sln", NULL),
+            BuildPath(&projectRoot, "projects/VS2022/", internalName, ".sln", NULL),
+            vsSolutionReplacements, sizeof(vsSolutionReplacements)/sizeof(TextReplacement));
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Build system generated successfully: Visual Studio 2022\n");
+    }
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Build system: CMake");
+
+    // Project build system: CMake
+    //-------------------------------------------------------------------------------------
+    if (input.requestedBuildSystems[4])
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generating build system: CMake\n");
+
+        // Create required output directories
+        // WARNING: CMake directory is created on internal name directory, not on repo directory
+        PathBuilder cmakeRoot = { 0 };
+        SetPathRoot(&cmakeRoot, outPath, internalName);
+        AddGenDirectory(&plan, BuildPath(&cmakeRoot, "projects/CMake", NULL));
+
+        // TODO: Add CMake build system
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Build system generated successfully: CMake\n");
+    }
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Build system: GitHub Actions");
+
+    // Project build system: GitHub Actions
+    // - Windows: Uses VS2022 project
+    // - Linux, macOS, WebAssembly: Uses Makefile project
+    // WARNING: Expects the PROJECT_NAME to be the repository-name (as generated by default)
+    //-------------------------------------------------------------------------------------
+    if (input.requestedBuildSystems[5])
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generating build system: GitHub Actions (CI/CD workflows)\n");
+
+        // Create required output directories
+        AddGenDirectory(&plan, BuildPath(&projectRoot, ".github/workflows", NULL));
+
+        // Copy GitHub workflows: Windows, Linux, macOS, Webassembly
+        const char *workflowFileNames[4] = { "build_windows.yml", "build_linux.yml", "build_macos.yml", "build_webassembly.yml" };
+        for (int i = 0; i < 4; i++)
+        {
+            AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, ".github/workflows/", workflowFileNames[i], NULL),
+                BuildPath(&projectRoot, ".github/workflows/", workflowFileNames[i], NULL), NULL);
+        }
+
+        AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Build system generated successfully: GitHub Actions (CI/CD workflows)\n");
+    }
+    //-------------------------------------------------------------------------------------
+
+    EndGenPlanSection(&plan);
+    BeginGenPlanSection(&plan, "Additional files");
+
+    // Update additional files required for product building
+    //  - src/project_name.rc   -> Windows: Executable resource file, includes .ico and metadata
+    //  - src/project_name.ico  -> Product icon, required for Window resource file
+    //  - src/project_name.icns -> macOS: Product icon, required by Info.plist
+    //  - src/Info.plist        -> macOS application resource file, includes .icns and metadata
+    //  - src/minshell.html     -> Web: Html minimum shell for WebAssembly application, preconfigured
+    //-------------------------------------------------------------------------------------
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generating additional files\n");
+
+    // Update src/project_name.rc
+    // TODO: Replace "project_name.ico" by GetFileName(rpcGetText(project, "PROJECT_ICON_FILE")) if possible
+    TextReplacement resourceReplacements[] = {
+        { "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME") },
+        { "project_name", internalName },
+        { "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION") },
+        { "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME") },
+        { "ProjectYear", currentYearText },
+    };
+    AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "src/project_name.rc", NULL),
+        BuildPath(&sourceRoot, internalName, ".rc", NULL),
+        resourceReplacements, sizeof(resourceReplacements)/sizeof(TextReplacement));
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, TextFormat("INFO: Generated Windows resource file successfully: %s/%s.rc\n",
+        sourcePath, internalName));
+
+    // Copy src/project_name.rc.data
+    // TODO: It should be generated but ok for now
+    AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "src/project_name.rc.data", NULL),
+        BuildPath(&sourceRoot, internalName, ".rc.data", NULL), NULL);
+
+    // Copy src/project_name.ico to src/project_name.ico
+    // TODO: Generate .ico file from .png if required?
+    if (FileExists(rpcGetText(project, "PROJECT_ICON_FILE")))
+    {
+        const char *iconFilePath = BuildPath(&sourceRoot, TextReplace(GetFileName(rpcGetText(project, "PROJECT_ICON_FILE")), "project_name", internalName), NULL);
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, rpcGetText(project, "PROJECT_ICON_FILE"), iconFilePath,
+            TextFormat("INFO: Added icon file successfully: %s\n", iconFilePath));
+    }
+    else
+    {
+        AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "src/project_name.ico", NULL),
+            BuildPath(&sourceRoot, internalName, ".ico", NULL),
+            TextFormat("INFO: Added icon file successfully: %s/%s.ico\n", sourcePath, internalName));
+    }
+
+    // Copy src/project_name.icns to src/project_name.icns
+    // TODO: Generate .icns from input .ico/.png
+    AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "src/project_name.icns", NULL),
+        BuildPath(&sourceRoot, internalName, ".icns", NULL),
+        "INFO: Added icon file (.icns) successfully (macOS)\n");
+
+    // Update src/Info.plist
+    TextReplacement plistReplacements[] = {
+        { "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME") },
+        { "project_name", internalName },
+        { "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION") },
+        { "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME") },
+        { "project_developer", TextToSnake(rpcGetText(project, "PROJECT_PUBLISHER_NAME")) },
+        { "ProjectYear", currentYearText },
+    };
+    AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "src/Info.plist", NULL),
+        BuildPath(&sourceRoot, "Info.plist", NULL),
+        plistReplacements, sizeof(plistReplacements)/sizeof(TextReplacement));
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generated Info.plist successfully (macOS)\n");
+
+    // Update src/minshell.html
+    // Review Webpage, links, OpenGraph/X card, keywords...
+    // NOTE: TextToLower() returns a static buffer, lowercase texts must be copied before filling replacements
+    char developerNameLower[256] = { 0 };
+    char developerUrlLower[256] = { 0 };
+    strcpy(developerNameLower, TextToLower(rpcGetText(project, "PROJECT_DEVELOPER_NAME")));
+    strcpy(developerUrlLower, TextToLower(rpcGetText(project, "PROJECT_DEVELOPER_URL")));
+    TextReplacement shellReplacements[] = {
+        { "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME") },
+        { "project_name", internalName },
+        { "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION") },
+        { "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME") },
+        { "project_developer", developerNameLower },
+        { "ProjectDeveloperUrl", developerUrlLower },
+    };
+    AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "src/minshell.html", NULL),
+        BuildPath(&projectRoot, "src/minshell.html", NULL),
+        shellReplacements, sizeof(shellReplacements)/sizeof(TextReplacement));
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generated minshell.html successfully (WebAssembly)\n");
+    //-------------------------------------------------------------------------------------
+
+    // Update README.md
+    TextReplacement readmeReplacements[] = {
+        { "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME") },
+        { "project_name", internalName },
+        { "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION") },
+        { "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME") },
+        { "ProjectYear", currentYearText },
+    };
+    AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "README.md", NULL),
+        BuildPath(&projectRoot, "README.md", NULL),
+        readmeReplacements, sizeof(readmeReplacements)/sizeof(TextReplacement));
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generated README.md file successfully\n");
+
+    // Update LICENSE, including ProjectDeveloper
+    TextReplacement licenseReplacements[] = {
+        { "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME") },
+        { "ProjectYear", currentYearText },
+    };
+    AddGenRenderJob(&plan.fileJobs, BuildPath(&templateRoot, "LICENSE", NULL),
+        BuildPath(&projectRoot, "LICENSE", NULL),
+        licenseReplacements, sizeof(licenseReplacements)/sizeof(TextReplacement));
+    AddGenJob(&plan.fileJobs, GEN_JOB_LOG, NULL, NULL, "INFO: Generated LICENSE file successfully: zlib/libpng\n");
+
+    // Copy from template files that do not require customization: CONVENTIONS.md, .gitignore
+    AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, "CONVENTIONS.md", NULL),
+        BuildPath(&projectRoot, "CONVENTIONS.md", NULL),
+        "INFO: Generated CONVENTIONS.md file successfully\n");
+    AddGenJob(&plan.fileJobs, GEN_JOB_COPY, BuildPath(&templateRoot, ".gitignore", NULL),
+        BuildPath(&projectRoot, ".gitignore", NULL),
+        "INFO: Generated .gitignore file successfully\n\n");
+
+    EndGenPlanSection(&plan);
+
+    // Update project configuration .rpc to defined values by [rpc] tool
+    plan.configData = LoadTemplateConfigData(BuildPath(&templateRoot, "project_name.rpc", NULL));
+    rini_set_value_text(&plan.configData, "PROJECT_REPO_NAME", repoName, NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_INTERNAL_NAME", internalName, NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_COMMERCIAL_NAME", rpcGetText(project, "PROJECT_COMMERCIAL_NAME"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_SHORT_NAME", rpcGetText(project, "PROJECT_SHORT_NAME"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_VERSION", rpcGetText(project, "PROJECT_VERSION"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_DESCRIPTION", rpcGetText(project, "PROJECT_DESCRIPTION"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_PUBLISHER_NAME", rpcGetText(project, "PROJECT_PUBLISHER_NAME"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_DEVELOPER_NAME", rpcGetText(project, "PROJECT_DEVELOPER_NAME"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_DEVELOPER_URL", rpcGetText(project, "PROJECT_DEVELOPER_URL"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_DEVELOPER_EMAIL", rpcGetText(project, "PROJECT_DEVELOPER_EMAIL"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_ICON_FILE", rpcGetText(project, "PROJECT_ICON_FILE"), NULL);
+    rini_set_value_text(&plan.configData, "PROJECT_ASSETS_LINK_MODE", (assetsLinkMode != NULL)? assetsLinkMode : "COPY", NULL);
+
+    plan.configJob.type = GEN_JOB_WRITE;
+    plan.configJob.dependency = -1;
+    plan.configJob.section = configSection;
+    plan.configJob.srcPath = MemArenaCopyText(plan.arena, BuildPath(&templateRoot, "project_name.rpc", NULL));
+    plan.configJob.dstPath = MemArenaCopyText(plan.arena, BuildPath(&projectRoot, internalName, ".rpc", NULL));
+
+    SetGenPlanDependencies(&plan);
+    plan.valid = true;
+
+    EndProfileEvent(planEvent, 0, 0);
+
+    return plan;
+}
+
+// Generate project: plan and execute
+static void GenerateProject(rpcProjectConfig project, rpcProjectInput input, const char *outPath)
+{
+    GenPlan plan = LoadGenPlan(project, input, outPath, NULL);
+
+    if (plan.valid) ExecuteGenPlan(&plan);
+
+    UnloadGenPlan(&plan);
+}
+
+// Packing of directory files into a binary blob
+// NOTE: Files are compressed on worker threads, package is assembled in directory files order,
+// so package data does not depend on threads count, files paths are stored relative to packed directory
+static char *PackDirectoryData(const char *baseDirPath, int level, int *packSize)
+{
+    unsigned char *data = NULL;
+    *packSize = 0;
+
+    FilePathList files = LoadDirectoryFilesEx(baseDirPath, NULL, true);
+
+    if (files.count > 0)
+    {
+        PackTask *tasks = (PackTask *)RL_CALLOC(files.count, sizeof(PackTask));
+        int baseDirPathLength = (int)strlen(baseDirPath);
+
+        for (unsigned int i = 0; i < files.count; i++)
+        {
+            // Get file path relative to packed directory, using '/' as separator
+            const char *relativePath = files.paths[i];
+            if ((strncmp(relativePath, baseDirPath, baseDirPathLength) == 0) &&
+                ((relativePath[baseDirPathLength] == '/') || (relativePath[baseDirPathLength] == '\\'))) relativePath += (baseDirPathLength + 1);
+
+            strncpy(tasks[i].filePath, relativePath, 255);
+            for (int c = 0; tasks[i].filePath[c] != '\0'; c++) if (tasks[i].filePath[c] == '\\') tasks[i].filePath[c] = '/';
+
+            tasks[i].srcPath = files.paths[i];
+            tasks[i].level = level;
+            tasks[i].fileData = LoadFileData(files.paths[i], &tasks[i].fileSize);
+            tasks[i].text = (tasks[i].fileData != NULL) && (memchr(tasks[i].fileData, 0, tasks[i].fileSize) == NULL);
+        }
+
+        double startTime = GetProfileTime();
+
+        // Preset dictionary shared by text files, small text files share most of their vocabulary
+        int dictSize = 0;
+        unsigned char *dictData = LoadPackDictionary(tasks, files.count, &dictSize);
+
+        for (unsigned int i = 0; i < files.count; i++)
+        {
+            tasks[i].dictData = dictData;
+            tasks[i].dictSize = dictSize;
+        }
+
+        WorkerPool *pool = LoadWorkerPool(generationThreadCount);
+        RunWorkerTasks(pool, ProcessPackTask, tasks, files.count);
+        WaitWorkerTasks(pool);
+        UnloadWorkerPool(pool);
+
+        // Package assembled in files order
+        PackWriter writer = { 0 };
+        long long totalSize = 0;
+        long long totalCompSize = 0;
+        int dictFileCount = 0;
+
+        for (unsigned int i = 0; i < files.count; i++)
+        {
+            PackTask *task = &tasks[i];
+
+            if (AddPackFile(&writer, task->filePath, task->compFileData, task->compFileSize, task->fileSize, task->crc32, task->flags))
+            {
+                LOG("INFO: Packed file: %s (%i -> %i bytes, %.1f%%%s, %.2f ms)\n", task->filePath, task->fileSize, task->compFileSize,
+                    (task->fileSize > 0)? 100.0f*task->compFileSize/task->fileSize : 100.0f, (task->flags & PACK_FILE_DICTIONARY)? ", dictionary" : "", task->time/1000.0);
+
+                totalSize += task->fileSize;
+                totalCompSize += task->compFileSize;
+                if (task->flags & PACK_FILE_DICTIONARY) dictFileCount++;
+            }
+            else LOG("WARNING: File could not be packed: %s\n", task->srcPath);
+
+            UnloadFileData(task->fileData);
+            RL_FREE(task->compFileData);
+        }
+
+        // NOTE: Dictionary is only stored if used by some file
+        if (dictFileCount > 0)
+        {
+            AddPackDictionary(&writer, dictData, dictSize, level);
+            totalCompSize += writer.dictCompSize;
+        }
+
+        int entryCount = writer.entryCount;
+        data = ExportPackData(&writer, packSize);
+
+        LOG("INFO: Template package: %i files (%i using %i bytes dictionary), %lli -> %lli bytes (%.1f%%), level %i, %.2f ms\n", entryCount,
+            dictFileCount, (dictFileCount > 0)? dictSize : 0, totalSize, totalCompSize, (totalSize > 0)? 100.0f*totalCompSize/totalSize : 100.0f,
+            level, (GetProfileTime() - startTime)/1000.0);
+
+        RL_FREE(dictData);
+        RL_FREE(tasks);
+    }
+
+    UnloadDirectoryFiles(files);
+
+    return (char *)data;
+}
+
+// Process package file compression task, worker task callback
+// NOTE: Text files are compressed with and without preset dictionary, smaller data is kept
+// WARNING: Called from worker threads, raylib functions using internal static buffers can not be used
+static void ProcessPackTask(void *userData, int index)
+{
+    PackTask *task = &((PackTask *)userData)[index];
+    double startTime = GetProfileTime();
+
+    if ((task->fileData != NULL) || (task->fileSize == 0))
+    {
+        task->crc32 = (unsigned int)mz_crc32(MZ_CRC32_INIT, task->fileData, task->fileSize);
+        task->compFileData = CompressPackData(task->fileData, task->fileSize, NULL, 0, task->level, &task->compFileSize);
+
+        if (task->text && (task->dictData != NULL) && (task->compFileData != NULL))
+        {
+            int compFileSize = 0;
+            unsigned char *compFileData = CompressPackData(task->fileData, task->fileSize, task->dictData, task->dictSize, task->level, &compFileSize);
+
+            if ((compFileData != NULL) && (compFileSize < task->compFileSize))
+            {
+                RL_FREE(task->compFileData);
+                task->compFileData = compFileData;
+                task->compFileSize = compFileSize;
+                task->flags |= PACK_FILE_DICTIONARY;
+            }
+            else RL_FREE(compFileData);
+        }
+    }
+
+    task->time = GetProfileTime() - startTime;
+}
+
+// Compress package data output callback, data appended to writer buffer
+static int AppendPackDataCallback(const void *data, int size, void *userData)
+{
+    AppendPackData((PackWriter *)userData, data, (unsigned int)size);
+    return 1;
+}
+
+// Compress package data (raw deflate), preset dictionary optional
+// NOTE: Dictionary is compressed first and flushed to a byte boundary, data is compressed next
+// referencing dictionary matches, only data compressed after dictionary is returned, decompressor
+// must start with dictionary already in its window; level 0 stores data, level 10 is the best (slowest)
+static unsigned char *CompressPackData(const unsigned char *data, int dataSize, const unsigned char *dictData, int dictSize, int level, int *compDataSize)
+{
+    PackWriter output = { 0 };
+    tdefl_compressor *comp = (tdefl_compressor *)RL_MALLOC(sizeof(tdefl_compressor));
+    unsigned int flags = tdefl_create_comp_flags_from_zip_params(level, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+    unsigned int dictCompSize = 0;
+    bool result = (tdefl_init(comp, AppendPackDataCallback, &output, (int)flags) == TDEFL_STATUS_OKAY);
+
+    if (result && (dictData != NULL) && (dictSize > 0))
+    {
+        result = (tdefl_compress_buffer(comp, dictData, dictSize, TDEFL_SYNC_FLUSH) == TDEFL_STATUS_OKAY);
+        dictCompSize = output.size;
+    }
+
+    if (result) result = (tdefl_compress_buffer(comp, data, dataSize, TDEFL_FINISH) == TDEFL_STATUS_DONE);
+
+    RL_FREE(comp);
+
+    *compDataSize = 0;
+    if (!result)
+    {
+        RL_FREE(output.data);
+        return NULL;
+    }
+
+    // NOTE: Compressed data required for an empty buffer could be empty
+    if (output.data == NULL) output.data = (unsigned char *)RL_CALLOC(1, 1);
+
+    *compDataSize = (int)(output.size - dictCompSize);
+    if (dictCompSize > 0) memmove(output.data, output.data + dictCompSize, *compDataSize);
+
+    return output.data;
+}
+
+// Load package preset dictionary, concatenating text files samples
+// NOTE: Samples are taken from text files start (license headers, build boilerplate, common
+// declarations), repeated samples are skipped; last dictionary bytes are closer to compressed
+// data (shorter match distances), so first files samples are placed at dictionary end
+static unsigned char *LoadPackDictionary(const PackTask *tasks, int count, int *dictSize)
+{
+    unsigned char *dictData = (unsigned char *)RL_MALLOC(RPC_PACK_DICTIONARY_SIZE);
+    int size = 0;
+
+    for (int i = 0; (i < count) && (size < RPC_PACK_DICTIONARY_SIZE); i++)
+    {
+        if (!tasks[i].text || (tasks[i].fileSize == 0)) continue;
+
+        int sampleSize = (tasks[i].fileSize < RPC_PACK_DICTIONARY_SAMPLE)? tasks[i].fileSize : RPC_PACK_DICTIONARY_SAMPLE;
+        if (sampleSize > (RPC_PACK_DICTIONARY_SIZE - size)) sampleSize = RPC_PACK_DICTIONARY_SIZE - size;
+
+        // Check sample is not already in dictionary
+        unsigned char *dictStart = dictData + RPC_PACK_DICTIONARY_SIZE - size;
+        bool found = false;
+
+        for (int k = 0; (k + sampleSize) <= size; k++)
+        {
+            if (memcmp(dictStart + k, tasks[i].fileData, sampleSize) == 0) { found = true; break; }
+        }
+
+        if (!found)
+        {
+            memcpy(dictStart - sampleSize, tasks[i].fileData, sampleSize);
+            size += sampleSize;
+        }
+    }
+
+    if (size == 0)
+    {
+        RL_FREE(dictData);
+        dictData = NULL;
+    }
+    else memmove(dictData, dictData + RPC_PACK_DICTIONARY_SIZE - size, size);
+
+    *dictSize = size;
+
+    return dictData;
+}
+
+// Unpacking of directory files from a binary blob
+static void UnpackDirectoryData(const char *outputDirPath, const PackData *pack)
+{
+    for (int i = 0; i < pack->entryCount; i++)
+    {
+        char filePath[RPC_MAX_PATH_LENGTH] = { 0 };
+        snprintf(filePath, RPC_MAX_PATH_LENGTH, "%s/%s", outputDirPath, pack->entries[i].filePath);
+        MakeDirectory(GetDirectoryPath(filePath));
+
+        if (!UnpackPackFile(pack, i, filePath, NULL))
+        {
+            LOG("WARNING: File data could not be decompressed: %s\n", pack->entries[i].filePath);
+            break;
+        }
+    }
+}
+
+// Load a text file data from memory packed data
+// NOTE: File found with one lookup table probe and decompressed directly into text buffer
+// (entry size is known, no intermediate buffer required), data validated with entry CRC32;
+// files compressed with preset dictionary are decompressed after dictionary, in the same buffer
+static char *LoadFileTextPack(const char *fileName, const PackData *pack)
+{
+    char *fileData = NULL;
+    int index = GetPackEntryIndex(pack, fileName);
+
+    if (index >= 0)
+    {
+        const PackFileEntry *entry = &pack->entries[index];
+        int dictSize = (entry->flags & PACK_FILE_DICTIONARY)? pack->dictSize : 0;
+
+        // NOTE: We make sure the text data ends with /0
+        fileData = (char *)RL_CALLOC(dictSize + entry->fileSize + 1, 1);
+        if (dictSize > 0) memcpy(fileData, pack->dictData, dictSize);
+
+        tinfl_decompressor decomp = { 0 };
+        size_t inSize = entry->compFileSize;
+        size_t outSize = entry->fileSize;
+        tinfl_init(&decomp);
+
+        tinfl_status status = tinfl_decompress(&decomp, pack->data + entry->offset, &inSize, (unsigned char *)fileData,
+            (unsigned char *)fileData + dictSize, &outSize, TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+
+        if ((status == TINFL_STATUS_DONE) && (outSize == (size_t)entry->fileSize) &&
+            ((unsigned int)mz_crc32(MZ_CRC32_INIT, (const unsigned char *)fileData + dictSize, entry->fileSize) == entry->crc32))
+        {
+            if (dictSize > 0)
+            {
+                memmove(fileData, fileData + dictSize, entry->fileSize);
+                fileData[entry->fileSize] = '\0';
+            }
+        }
+        else
+        {
+            LOG("WARNING: File not loaded properly from pack: %s\n", fileName);
+            RL_FREE(fileData);
+            fileData = NULL;
+        }
+    }
+
+    return fileData;
+}
+
+// Unpack package file to output file, streamed decompression
+// NOTE: Data is decompressed into a fixed size window (deflate dictionary size) and written as it is
+// decompressed, memory required does not depend on file size, CRC32 and hash are computed on the fly,
+// output file is removed if data is not valid
+// WARNING: Called from worker threads, raylib functions using internal static buffers can not be used
+static bool UnpackPackFile(const PackData *pack, int index, const char *filePath, unsigned long long *hash)
+{
+    if (hash != NULL) *hash = 0;
+    if ((index < 0) || (index >= pack->entryCount)) return false;
+
+    const PackFileEntry *entry = &pack->entries[index];
+    FILE *file = fopen(filePath, "wb");
+    if (file == NULL) return false;
+
+    tinfl_decompressor *decomp = (tinfl_decompressor *)RL_MALLOC(sizeof(tinfl_decompressor));
+    unsigned char *window = (unsigned char *)RL_MALLOC(TINFL_LZ_DICT_SIZE);
+    const unsigned char *input = pack->data + entry->offset;
+    size_t inputSize = entry->compFileSize;
+    size_t windowOffset = 0;
+
+    // NOTE: Preset dictionary is placed at window start, data decompressed after it
+    if (entry->flags & PACK_FILE_DICTIONARY)
+    {
+        memcpy(window, pack->dictData, pack->dictSize);
+        windowOffset = pack->dictSize;
+    }
+    unsigned int dataSize = 0;
+    unsigned int dataCrc = MZ_CRC32_INIT;
+    unsigned long long dataHash = 0xcbf29ce484222325ULL;
+    bool result = false;
+
+    tinfl_init(decomp);
+
+    while (true)
+    {
+        size_t inSize = inputSize;
+        size_t outSize = TINFL_LZ_DICT_SIZE - windowOffset;
+
+        // NOTE: All input data is provided, decompressor fails if it requires more input
+        tinfl_status status = tinfl_decompress(decomp, input, &inSize, window, window + windowOffset, &outSize, 0);
+        input += inSize;
+        inputSize -= inSize;
+
+        if (outSize > 0)
+        {
+            dataCrc = (unsigned int)mz_crc32(dataCrc, window + windowOffset, outSize);
+            dataHash = UpdateHashFNV64(dataHash, window + windowOffset, (int)outSize);
+            dataSize += (unsigned int)outSize;
+
+            if ((dataSize > (unsigned int)entry->fileSize) || (fwrite(window + windowOffset, 1, outSize, file) != outSize)) break;
+        }
+
+        windowOffset = (windowOffset + outSize) & (TINFL_LZ_DICT_SIZE - 1);
+
+        if (status == TINFL_STATUS_DONE)
+        {
+            result = ((dataSize == (unsigned int)entry->fileSize) && (dataCrc == entry->crc32));
+            break;
+        }
+        else if (status != TINFL_STATUS_HAS_MORE_OUTPUT) break;
+    }
+
+    RL_FREE(window);
+    RL_FREE(decomp);
+
+    if (fclose(file) != 0) result = false;
+    if (!result) remove(filePath);
+    else if (hash != NULL) *hash = dataHash;
+
+    return result;
+}
+
+// Add file to package, data already compressed (CompressPackData())
+// NOTE: File path must be unique in package, relative to packed directory
+static bool AddPackFile(PackWriter *writer, const char *filePath, const unsigned char *compFileData, int compFileSize, int fileSize, unsigned int crc32, unsigned int flags)
+{
+    if ((filePath == NULL) || (strlen(filePath) >= 256) || (compFileData == NULL)) return false;
+
+    if (writer->entryCount >= writer->entryCapacity)
+    {
+        writer->entryCapacity = (writer->entryCapacity > 0)? writer->entryCapacity*2 : 64;
+        writer->entries = (PackFileEntry *)RL_REALLOC(writer->entries, writer->entryCapacity*sizeof(PackFileEntry));
+    }
+
+    PackFileEntry *entry = &writer->entries[writer->entryCount];
+    memset(entry, 0, sizeof(PackFileEntry));
+    entry->offset = writer->size;
+    entry->fileSize = fileSize;
+    entry->compFileSize = compFileSize;
+    entry->crc32 = crc32;
+    entry->flags = flags;
+    strcpy(entry->filePath, filePath);
+    writer->entryCount++;
+
+    AppendPackData(writer, compFileData, compFileSize);
+
+    return true;
+}
+
+// Add preset dictionary to package, data is compressed
+// NOTE: Dictionary must be the same used to compress package files flagged with PACK_FILE_DICTIONARY
+static void AddPackDictionary(PackWriter *writer, const unsigned char *dictData, int dictSize, int level)
+{
+    int dictCompSize = 0;
+    unsigned char *dictCompData = CompressPackData(dictData, dictSize, NULL, 0, level, &dictCompSize);
+
+    if (dictCompData != NULL)
+    {
+        writer->dictOffset = writer->size;
+        writer->dictSize = dictSize;
+        writer->dictCompSize = dictCompSize;
+        AppendPackData(writer, dictCompData, dictCompSize);
+    }
+
+    RL_FREE(dictCompData);
+}
+
+// Export package data, entries and lookup table appended (writer unloaded)
+// NOTE: Entries and lookup table are aligned to 8 bytes, so they can be used directly from package data
+static unsigned char *ExportPackData(PackWriter *writer, int *packSize)
+{
+    static const unsigned char padding[8] = { 0 };
+    PackFooter footer = { 0 };
+
+    // Lookup table size: power of two, at least twice entries count
+    footer.lookupSize = 16;
+    while (footer.lookupSize < writer->entryCount*2) footer.lookupSize *= 2;
+
+    int *lookup = (int *)RL_MALLOC(footer.lookupSize*sizeof(int));
+    for (int i = 0; i < footer.lookupSize; i++) lookup[i] = -1;
+
+    for (int i = 0; i < writer->entryCount; i++)
+    {
+        const char *filePath = writer->entries[i].filePath;
+        unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)filePath, (int)strlen(filePath)) & (footer.lookupSize - 1);
+
+        while (lookup[slot] >= 0) slot = (slot + 1) & (footer.lookupSize - 1);
+        lookup[slot] = i;
+    }
+
+    footer.dictOffset = writer->dictOffset;
+    footer.dictSize = writer->dictSize;
+    footer.dictCompSize = writer->dictCompSize;
+
+    AppendPackData(writer, padding, (8 - (writer->size%8))%8);
+    footer.entriesOffset = writer->size;
+    footer.entryCount = writer->entryCount;
+    AppendPackData(writer, writer->entries, writer->entryCount*sizeof(PackFileEntry));
+
+    AppendPackData(writer, padding, (8 - (writer->size%8))%8);
+    footer.lookupOffset = writer->size;
+    AppendPackData(writer, lookup, footer.lookupSize*sizeof(int));
+
+    footer.packSize = writer->size + sizeof(PackFooter);
+    footer.version = RPC_PACK_VERSION;
+    memcpy(footer.fourcc, "rpch", 4);
+    AppendPackData(writer, &footer, sizeof(PackFooter));
+
+    RL_FREE(lookup);
+    RL_FREE(writer->entries);
+
+    unsigned char *data = writer->data;
+    *packSize = (int)writer->size;
+    memset(writer, 0, sizeof(PackWriter));
+
+    return data;
+}
+
+// Append data to package, buffer grows as required
+static void AppendPackData(PackWriter *writer, const void *data, unsigned int size)
+{
+    if ((writer->size + size) > writer->capacity)
+    {
+        unsigned int capacity = (writer->capacity > 0)? writer->capacity : 65536;
+        while ((writer->size + size) > capacity) capacity *= 2;
+
+        writer->data = (unsigned char *)RL_REALLOC(writer->data, capacity);
+        writer->capacity = capacity;
+    }
+
+    if (size > 0) memcpy(writer->data + writer->size, data, size);
+    writer->size += size;
+}
+
+#if defined(BUILD_TEMPLATE_INTO_EXE)
+// Load package from memory data, package found at the end of data
+// NOTE: Package data is not copied, it must be kept while package is used and package start
+// must be aligned to 8 bytes, package is not valid (no entries) if footer or tables are not consistent
+static PackData LoadPackData(const unsigned char *data, int dataSize)
+{
+    PackData pack = { 0 };
+    PackFooter footer = { 0 };
+
+    if ((data == NULL) || (dataSize < (int)sizeof(PackFooter))) return pack;
+
+    memcpy(&footer, data + dataSize - sizeof(PackFooter), sizeof(PackFooter));
+
+    if ((memcmp(footer.fourcc, "rpch", 4) != 0) || (footer.version != RPC_PACK_VERSION))
+    {
+        LOG("WARNING: Package format not supported\n");
+        return pack;
+    }
+
+    // Check package tables are inside package data
+    if ((footer.packSize > (unsigned int)dataSize) || (footer.entryCount < 0) || (footer.lookupSize <= 0) ||
+        ((footer.lookupSize & (footer.lookupSize - 1)) != 0) || (footer.lookupSize < footer.entryCount) ||
+        (footer.entriesOffset > footer.packSize) || (footer.lookupOffset > footer.packSize) ||
+        ((footer.packSize - footer.entriesOffset)/sizeof(PackFileEntry) < (unsigned int)footer.entryCount) ||
+        ((footer.packSize - footer.lookupOffset)/sizeof(int) < (unsigned int)footer.lookupSize) ||
+        (footer.dictSize < 0) || (footer.dictSize > TINFL_LZ_DICT_SIZE) || (footer.dictCompSize < 0) ||
+        (footer.dictOffset > footer.packSize) || ((footer.packSize - footer.dictOffset) < (unsigned int)footer.dictCompSize))
+    {
+        LOG("WARNING: Package data not valid\n");
+        return pack;
+    }
+
+    pack.data = data + dataSize - footer.packSize;
+
+    if (((size_t)pack.data%8) != 0)
+    {
+        LOG("WARNING: Package data not aligned\n");
+        memset(&pack, 0, sizeof(PackData));
+        return pack;
+    }
+
+    pack.size = footer.packSize;
+    pack.entries = (const PackFileEntry *)(pack.data + footer.entriesOffset);
+    pack.entryCount = footer.entryCount;
+    pack.lookup = (const int *)(pack.data + footer.lookupOffset);
+    pack.lookupSize = footer.lookupSize;
+
+    // Decompress preset dictionary, shared by all files using it
+    if (footer.dictSize > 0)
+    {
+        pack.dictData = (unsigned char *)RL_MALLOC(footer.dictSize);
+        pack.dictSize = footer.dictSize;
+
+        if (tinfl_decompress_mem_to_mem(pack.dictData, footer.dictSize, pack.data + footer.dictOffset, footer.dictCompSize, 0) != (size_t)footer.dictSize)
+        {
+            LOG("WARNING: Package dictionary not valid\n");
+            UnloadPackData(&pack);
+        }
+    }
+
+    return pack;
+}
+#endif
+
+// Unload package data, preset dictionary released
+// NOTE: Package data is not owned by package, only preset dictionary is released
+static void UnloadPackData(PackData *pack)
+{
+    RL_FREE(pack->dictData);
+
+    memset(pack, 0, sizeof(PackData));
+}
+
+// Get package entry index for file path (-1 if not found)
+// NOTE: File path hash (FNV-1a 64bit) is the lookup table slot, linear probing on collisions
+static int GetPackEntryIndex(const PackData *pack, const char *filePath)
+{
+    if ((pack->entryCount == 0) || (filePath == NULL)) return -1;
+
+    unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)filePath, (int)strlen(filePath)) & (pack->lookupSize - 1);
+
+    for (int i = 0; i < pack->lookupSize; i++)
+    {
+        int index = pack->lookup[slot];
+
+        if ((index < 0) || (index >= pack->entryCount)) break;
+        if (strcmp(pack->entries[index].filePath, filePath) == 0) return index;
+
+        slot = (slot + 1) & (pack->lookupSize - 1);
+    }
+
+    return -1;
+}
+
+#if defined(BUILD_TEMPLATE_INTO_EXE)
+// Load package file, package found at the end of file is mapped read-only
+// NOTE: Only package footer is read from file, package data is read into memory if mapping not available
+static PackFile LoadPackFile(const char *fileName)
+{
+    PackFile file = { 0 };
+    PackFooter footer = { 0 };
+
+    FILE *packFile = fopen(fileName, "rb");
+    if (packFile == NULL) return file;
+
+    long fileSize = 0;
+    if (fseek(packFile, 0, SEEK_END) == 0) fileSize = ftell(packFile);
+
+    if ((fileSize >= (long)sizeof(PackFooter)) && (fseek(packFile, fileSize - (long)sizeof(PackFooter), SEEK_SET) == 0) &&
+        (fread(&footer, sizeof(PackFooter), 1, packFile) == 1) && (memcmp(footer.fourcc, "rpch", 4) == 0))
+    {
+        if ((footer.version != RPC_PACK_VERSION) || (footer.packSize < sizeof(PackFooter)) || (footer.packSize > (unsigned int)fileSize))
+        {
+            LOG("WARNING: Package format not supported: %s\n", fileName);
+            fclose(packFile);
+            return file;
+        }
+
+        long packOffset = fileSize - (long)footer.packSize;
+
+        // Map package region, mapping offset aligned to page size (allocation granularity on Win32)
+#if !defined(PLATFORM_WEB) && !defined(_WIN32)
+        long mapOffset = packOffset - packOffset%sysconf(_SC_PAGESIZE);
+        void *mapData = mmap(NULL, (size_t)(fileSize - mapOffset), PROT_READ, MAP_PRIVATE, fileno(packFile), (off_t)mapOffset);
+
+        if (mapData != MAP_FAILED)
+        {
+            file.mapData = mapData;
+            file.mapSize = (size_t)(fileSize - mapOffset);
+        }
+#elif !defined(PLATFORM_WEB) && defined(_WIN32)
+        long mapOffset = packOffset - packOffset%65536;
+        void *fileHandle = CreateFileA(fileName, 0x80000000, 0x1, NULL, 3, 0x80, NULL);    // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+        if (fileHandle != (void *)-1)       // INVALID_HANDLE_VALUE
+        {
+            void *mapHandle = CreateFileMappingA(fileHandle, NULL, 0x02, 0, 0, NULL);     // PAGE_READONLY
+
+            if (mapHandle != NULL)
+            {
+                // NOTE: Mapped view keeps file mapping alive, handles not required anymore
+                file.mapData = MapViewOfFile(mapHandle, 0x04, 0, (unsigned long)mapOffset, (size_t)(fileSize - mapOffset)); // FILE_MAP_READ
+                file.mapSize = (size_t)(fileSize - mapOffset);
+                CloseHandle(mapHandle);
+            }
+
+            CloseHandle(fileHandle);
+        }
+#else
+        long mapOffset = packOffset;
+#endif
+        if (file.mapData != NULL) file.pack = LoadPackData((const unsigned char *)file.mapData + (packOffset - mapOffset), (int)footer.packSize);
+        else
+        {
+            file.readData = (unsigned char *)RL_MALLOC(footer.packSize);
+
+            if ((fseek(packFile, packOffset, SEEK_SET) == 0) && (fread(file.readData, footer.packSize, 1, packFile) == 1))
+            {
+                file.pack = LoadPackData(file.readData, (int)footer.packSize);
+            }
+        }
+    }
+
+    fclose(packFile);
+
+    if (file.pack.data == NULL) UnloadPackFile(&file);
+
+    return file;
+}
+#endif
+
+// Unload package file, mapped region released
+static void UnloadPackFile(PackFile *file)
+{
+#if !defined(PLATFORM_WEB) && !defined(_WIN32)
+    if (file->mapData != NULL) munmap(file->mapData, file->mapSize);
+#elif !defined(PLATFORM_WEB) && defined(_WIN32)
+    if (file->mapData != NULL) UnmapViewOfFile(file->mapData);
+#endif
+    UnloadPackData(&file->pack);
+    RL_FREE(file->readData);
+
+    memset(file, 0, sizeof(PackFile));
+}
+
+// Split string into multiple strings
+// NOTE: No memory is dynamically allocated
+static const char **GetSubtextPtrs(char *text, char delimiter, int *count)
+{
+    #define MAX_SUBTEXTPTRS_COUNT    1024
+
+    // WARNING: Input string is modified, '\0' is added in the delimiter and the resulting strings
+    // are returned as a static array of pointers
+    // Maximum number of pointed strings is set by MAX_TEXTSPLIT_COUNT
+    static const char *result[MAX_SUBTEXTPTRS_COUNT] = { NULL };
+
+    result[0] = text;
+    int counter = 1;
+    int textLength = TextLength(text);
+
+    if (text != NULL)
+    {
+        // Count how many substrings we have on text and point to every one
+        for (int i = 0; i < textLength; i++)
+        {
+            if (text[i] == '\0') break;
+            else if (text[i] == delimiter)
+            {
+                text[i] = '\0';   // Set an end of string at this point
+                result[counter] = text + i + 1;
+                counter++;
+
+                if (counter == MAX_SUBTEXTPTRS_COUNT) break;
+            }
+        }
+    }
+
+    *count = counter;
+    return result;
+}
+
+// Load text matcher for replacements patterns table, from matchers cache if already built
+// NOTE: Patterns are checked for possible overlaps once per table,
+// matcher is shared by all template files rendered with same patterns table
+static const TextMatcher *LoadTextMatcher(const char **patterns, int count)
+{
+    if (count > RPC_MAX_TEMPLATE_PATTERNS)
+    {
+        LOG("WARNING: Template patterns table too long, only first %i patterns replaced\n", RPC_MAX_TEMPLATE_PATTERNS);
+        count = RPC_MAX_TEMPLATE_PATTERNS;
+    }
+
+    // Get patterns table hash: patterns joined by '\0'
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < count; i++)
+    {
+        for (const unsigned char *c = (const unsigned char *)((patterns[i] != NULL)? patterns[i] : ""); ; c++)
+        {
+            hash ^= *c;
+            hash *= 0x100000001b3ULL;
+            if (*c == '\0') break;
+        }
+    }
+
+    for (int i = 0; i < textMatchers.count; i++)
+    {
+        const TextMatcher *matcher = textMatchers.matchers[i];
+        if ((matcher->hash != hash) || (matcher->count != count)) continue;
+
+        bool equal = true;
+        for (int p = 0; (p < count) && equal; p++) equal = (strcmp(matcher->patterns[p], (patterns[p] != NULL)? patterns[p] : "") == 0);
+        if (equal) return matcher;
+    }
+
+    TextMatcher *matcher = (TextMatcher *)RL_CALLOC(1, sizeof(TextMatcher));
+    matcher->count = count;
+    matcher->hash = hash;
+    matcher->patterns = (char **)RL_CALLOC((count > 0)? count : 1, sizeof(char *));
+    matcher->lengths = (int *)RL_CALLOC((count > 0)? count : 1, sizeof(int));
+
+    for (int i = 0; i < count; i++)
+    {
+        matcher->patterns[i] = TextCopyAlloc((patterns[i] != NULL)? patterns[i] : "");
+        matcher->lengths[i] = (int)strlen(matcher->patterns[i]);
+    }
+
+    // Check patterns overlaps: pattern found inside another one (not at start)
+    // or pattern ending with the beginning of another one (or itself)
+    for (int a = 0; (a < count) && !matcher->overlapping; a++)
+    {
+        if (matcher->lengths[a] == 0) continue;
+
+        for (int b = 0; (b < count) && !matcher->overlapping; b++)
+        {
+            if (matcher->lengths[b] == 0) continue;
+            if (strstr(matcher->patterns[a] + 1, matcher->patterns[b]) != NULL) matcher->overlapping = true;
+
+            int maxLength = (matcher->lengths[a] < matcher->lengths[b])? matcher->lengths[a] : matcher->lengths[b];
+            for (int k = 1; (k < maxLength) && !matcher->overlapping; k++)
+            {
+                if (memcmp(matcher->patterns[a] + matcher->lengths[a] - k, matcher->patterns[b], k) == 0) matcher->overlapping = true;
+            }
+        }
+    }
+
+    if (textMatchers.count >= textMatchers.capacity)
+    {
+        textMatchers.capacity = (textMatchers.capacity > 0)? textMatchers.capacity*2 : 16;
+        textMatchers.matchers = (TextMatcher **)RL_REALLOC(textMatchers.matchers, textMatchers.capacity*sizeof(TextMatcher *));
+    }
+
+    textMatchers.matchers[textMatchers.count++] = matcher;
+
+    return matcher;
+}
+
+// Unload text matchers cache
+static void UnloadTextMatchers(void)
+{
+    for (int i = 0; i < textMatchers.count; i++)
+    {
+        TextMatcher *matcher = textMatchers.matchers[i];
+
+        for (int p = 0; p < matcher->count; p++) RL_FREE(matcher->patterns[p]);
+        RL_FREE(matcher->patterns);
+        RL_FREE(matcher->lengths);
+        RL_FREE(matcher);
+    }
+
+    RL_FREE(textMatchers.matchers);
+    memset(&textMatchers, 0, sizeof(TextMatcherCache));
+}
+
+// Compile text template: literal spans and pattern slots, no replacement values required
+// NOTE 1: Only patterns from first pattern index are matched, slots refer to full table indices
+// NOTE 2: Overlapping occurrences are resolved by table order: first pattern in table takes precedence,
+// leftmost occurrence first, non-overlapping patterns tables are matched in a single text scan
+static TemplateSpan *CompileTextTemplate(const TextMatcher *matcher, int firstPattern, const char *text, int *spanCount)
+{
+    int textLength = (int)strlen(text);
+    int capacity = 32;
+    int counter = 0;
+    TemplateSpan *spans = (TemplateSpan *)RL_MALLOC(capacity*sizeof(TemplateSpan));
+
+    if (!matcher->overlapping)
+    {
+        // Scan text once: any two occurrences are disjoint or start at same position, so next occurrence
+        // of every pattern is kept and the nearest one replaced (first pattern in table if same position)
+        // NOTE: Patterns searches only move forward, no text position is searched twice for same pattern
+        int nextOccurrences[RPC_MAX_TEMPLATE_PATTERNS] = { 0 };
+
+        for (int p = firstPattern; p < matcher->count; p++)
+        {
+            const char *found = (matcher->lengths[p] > 0)? strstr(text, matcher->patterns[p]) : NULL;
+            nextOccurrences[p] = (found != NULL)? (int)(found - text) : textLength;
+        }
+
+        int literalStart = 0;
+
+        while (true)
+        {
+            int index = -1;
+            for (int p = firstPattern; p < matcher->count; p++)
+            {
+                if ((nextOccurrences[p] < textLength) && ((index == -1) || (nextOccurrences[p] < nextOccurrences[index]))) index = p;
+            }
+
+            if (index == -1) break;
+
+            if ((counter + 2) > capacity)
+            {
+                capacity *= 2;
+                spans = (TemplateSpan *)RL_REALLOC(spans, capacity*sizeof(TemplateSpan));
+            }
+
+            int position = nextOccurrences[index];
+            if (position > literalStart) spans[counter++] = (TemplateSpan){ literalStart, position - literalStart, -1 };
+            spans[counter++] = (TemplateSpan){ position, matcher->lengths[index], index };
+            literalStart = position + matcher->lengths[index];
+
+            // Search again patterns occurrences already passed
+            for (int p = firstPattern; p < matcher->count; p++)
+            {
+                if (nextOccurrences[p] < literalStart)
+                {
+                    const char *found = strstr(text + literalStart, matcher->patterns[p]);
+                    nextOccurrences[p] = (found != NULL)? (int)(found - text) : textLength;
+                }
+            }
+        }
+
+        if (literalStart < textLength)
+        {
+            if (counter >= capacity) spans = (TemplateSpan *)RL_REALLOC(spans, (capacity + 1)*sizeof(TemplateSpan));
+            spans[counter++] = (TemplateSpan){ literalStart, textLength - literalStart, -1 };
+        }
+    }
+    else
+    {
+        // Split literal spans pattern by pattern, in table order, as chained replacements would do:
+        // pattern occurrences are searched leftmost first, only inside text not already replaced
+        int nextCapacity = capacity;
+        TemplateSpan *nextSpans = (TemplateSpan *)RL_MALLOC(nextCapacity*sizeof(TemplateSpan));
+
+        if (textLength > 0) spans[counter++] = (TemplateSpan){ 0, textLength, -1 };
+
+        for (int p = firstPattern; p < matcher->count; p++)
+        {
+            int length = matcher->lengths[p];
+            if (length == 0) continue;
+
+            int nextCounter = 0;
+
+            for (int s = 0; s < counter; s++)
+            {
+                int start = spans[s].offset;
+                int end = spans[s].offset + spans[s].length;
+
+                for (int i = start; (spans[s].slot < 0) && (i <= (end - length)); i++)
+                {
+                    const char *found = (const char *)memchr(text + i, matcher->patterns[p][0], end - length + 1 - i);
+                    if (found == NULL) break;
+
+                    i = (int)(found - text);
+                    if (memcmp(found, matcher->patterns[p], length) != 0) continue;
+
+                    if ((nextCounter + 2) > nextCapacity)
+                    {
+                        nextCapacity *= 2;
+                        nextSpans = (TemplateSpan *)RL_REALLOC(nextSpans, nextCapacity*sizeof(TemplateSpan));
+                    }
+
+                    if (i > start) nextSpans[nextCounter++] = (TemplateSpan){ start, i - start, -1 };
+                    nextSpans[nextCounter++] = (TemplateSpan){ i, length, p };
+
+                    start = i + length;
+                    i = start - 1;
+                }
+
+                if (nextCounter >= nextCapacity)
+                {
+                    nextCapacity *= 2;
+                    nextSpans = (TemplateSpan *)RL_REALLOC(nextSpans, nextCapacity*sizeof(TemplateSpan));
+                }
+
+                if (spans[s].slot >= 0) nextSpans[nextCounter++] = spans[s];
+                else if (start < end) nextSpans[nextCounter++] = (TemplateSpan){ start, end - start, -1 };
+            }
+
+            TemplateSpan *swapSpans = spans;
+            spans = nextSpans;
+            nextSpans = swapSpans;
+
+            int swapCapacity = capacity;
+            capacity = nextCapacity;
+            nextCapacity = swapCapacity;
+
+            counter = nextCounter;
+        }
+
+        RL_FREE(nextSpans);
+    }
+
+    *spanCount = counter;
+
+    return spans;
+}
+
+// Render text template spans, slots are replaced by replacement texts
+static char *RenderTextTemplate(const char *text, const TemplateSpan *spans, int spanCount, const char **replacements, int count, MemArena *arena)
+{
+    int replacementLengths[RPC_MAX_TEMPLATE_PATTERNS] = { 0 };
+    for (int i = 0; (i < count) && (i < RPC_MAX_TEMPLATE_PATTERNS); i++) replacementLengths[i] = (replacements[i] != NULL)? (int)strlen(replacements[i]) : 0;
+
+    int outputLength = 0;
+    for (int i = 0; i < spanCount; i++) outputLength += (spans[i].slot < 0)? spans[i].length : replacementLengths[spans[i].slot];
+
+    // Generate output text into a single allocation
+    char *result = (arena != NULL)? (char *)MemArenaAlloc(arena, outputLength + 1) : (char *)RL_MALLOC(outputLength + 1);
+    char *resultPtr = result;
+
+    for (int i = 0; i < spanCount; i++)
+    {
+        if (spans[i].slot < 0)
+        {
+            memcpy(resultPtr, text + spans[i].offset, spans[i].length);
+            resultPtr += spans[i].length;
+        }
+        else if (replacementLengths[spans[i].slot] > 0)
+        {
+            memcpy(resultPtr, replacements[spans[i].slot], replacementLengths[spans[i].slot]);
+            resultPtr += replacementLengths[spans[i].slot];
+        }
+    }
+
+    *resultPtr = '\0';
+
+    return result;
+}
+
+// Resolve replacement texts from last to first, against the patterns following them in the table
+// NOTE: Resolved texts are allocated from arena, as chained TextReplaceAlloc() calls would replace them
+static const char **ResolveTextReplacements(const TextMatcher *matcher, const TextReplacement *replacements, MemArena *arena)
+{
+    const char **resolved = (const char **)MemArenaAlloc(arena, ((matcher->count > 0)? matcher->count : 1)*sizeof(const char *));
+
+    for (int i = matcher->count - 1; i >= 0; i--)
+    {
+        const char *replacement = (replacements[i].replacement != NULL)? replacements[i].replacement : "";
+
+        if ((i < (matcher->count - 1)) && (replacement[0] != '\0'))
+        {
+            int spanCount = 0;
+            TemplateSpan *spans = CompileTextTemplate(matcher, i + 1, replacement, &spanCount);
+
+            // NOTE: Replacement text is only rendered if some pattern is found
+            if ((spanCount > 1) || ((spanCount == 1) && (spans[0].slot >= 0))) resolved[i] = RenderTextTemplate(replacement, spans, spanCount, resolved, matcher->count, arena);
+            else resolved[i] = MemArenaCopyText(arena, replacement);
+
+            RL_FREE(spans);
+        }
+        else resolved[i] = MemArenaCopyText(arena, replacement);
+    }
+
+    return resolved;
+}
+
+// Replace multiple text patterns in a single pass
+// NOTE 1: Result is equivalent to chaining TextReplaceAlloc() calls in table order, replacement
+// texts must be first resolved against the patterns following them in the table (ResolveTextReplacements())
+// NOTE 2: Precompiled template must be compiled from same text and matcher patterns,
+// output is the same, no text search is required
+// NOTE 3: Result is allocated from arena if provided (RL_FREE otherwise)
+// WARNING: Unlike chained calls, new pattern occurrences spanning a replaced text boundary
+// are not considered, template placeholders must be distinct identifiers
+static char *TextReplaceTemplate(const char *text, const TextMatcher *matcher, const char **replacements, const CompiledTemplate *compiled, MemArena *arena)
+{
+    if ((text == NULL) || (matcher == NULL) || (replacements == NULL) || (matcher->count <= 0)) return NULL;
+
+    if (compiled != NULL) return RenderTextTemplate(text, compiled->spans, compiled->spanCount, replacements, matcher->count, arena);
+
+    int spanCount = 0;
+    TemplateSpan *spans = CompileTextTemplate(matcher, 0, text, &spanCount);
+    char *result = RenderTextTemplate(text, spans, spanCount, replacements, matcher->count, arena);
+    RL_FREE(spans);
+
+    return result;
+}
+
+// Worker threads pool functions
+//------------------------------------------------------------------------------------
+#if !defined(RPC_NO_THREADS)
+#if defined(_WIN32)
+static void InitMutex(rpcMutex *mutex) { InitializeSRWLock(mutex); }
+static void LockMutex(rpcMutex *mutex) { AcquireSRWLockExclusive(mutex); }
+static void UnlockMutex(rpcMutex *mutex) { ReleaseSRWLockExclusive(mutex); }
+static void DestroyMutex(rpcMutex *mutex) { (void)mutex; }
+static void InitCondition(rpcCondition *cond) { InitializeConditionVariable(cond); }
+static void WaitCondition(rpcCondition *cond, rpcMutex *mutex) { SleepConditionVariableSRW(cond, mutex, 0xffffffff, 0); }
+static void BroadcastCondition(rpcCondition *cond) { WakeAllConditionVariable(cond); }
+static void DestroyCondition(rpcCondition *cond) { (void)cond; }
+#else
+static void InitMutex(rpcMutex *mutex) { pthread_mutex_init(mutex, NULL); }
+static void LockMutex(rpcMutex *mutex) { pthread_mutex_lock(mutex); }
+static void UnlockMutex(rpcMutex *mutex) { pthread_mutex_unlock(mutex); }
+static void DestroyMutex(rpcMutex *mutex) { pthread_mutex_destroy(mutex); }
+static void InitCondition(rpcCondition *cond) { pthread_cond_init(cond, NULL); }
+static void WaitCondition(rpcCondition *cond, rpcMutex *mutex) { pthread_cond_wait(cond, mutex); }
+static void BroadcastCondition(rpcCondition *cond) { pthread_cond_broadcast(cond); }
+static void DestroyCondition(rpcCondition *cond) { pthread_cond_destroy(cond); }
+#endif
+
+// Worker thread main loop, processing tasks until pool is closed
+static void WorkerThreadLoop(WorkerPool *pool)
+{
+    LockMutex(&pool->mutex);
+
+    pool->threadStarted++;
+    int threadIndex = pool->threadStarted;
+
+    while (true)
+    {
+        while (!pool->closing && (pool->nextTask >= pool->taskCount)) WaitCondition(&pool->taskAvailable, &pool->mutex);
+
+        if (pool->closing) break;
+
+        int index = pool->nextTask;
+        pool->nextTask++;
+        pool->taskThread[index] = (unsigned char)threadIndex;
+
+        UnlockMutex(&pool->mutex);
+        pool->callback(pool->userData, index);
+        LockMutex(&pool->mutex);
+
+        pool->taskDone[index] = 1;
+        pool->completedCount++;
+        BroadcastCondition(&pool->taskCompleted);
+    }
+
+    UnlockMutex(&pool->mutex);
+}
+
+#if defined(_WIN32)
+static unsigned long __stdcall WorkerThreadEntry(void *arg) { WorkerThreadLoop((WorkerPool *)arg); return 0; }
+#else
+static void *WorkerThreadEntry(void *arg) { WorkerThreadLoop((WorkerPool *)arg); return NULL; }
+#endif
+#endif // !RPC_NO_THREADS
+
+// Load worker threads pool
+// NOTE: Using one thread or less, tasks are processed serially on caller thread
+static WorkerPool *LoadWorkerPool(int threadCount)
+{
+    WorkerPool *pool = (WorkerPool *)RL_CALLOC(1, sizeof(WorkerPool));
+
+    if (threadCount <= 0) threadCount = GetProcessorCount();
+    if (threadCount > RPC_MAX_WORKER_THREADS) threadCount = RPC_MAX_WORKER_THREADS;
+
+#if !defined(RPC_NO_THREADS)
+    if (threadCount > 1)
+    {
+        InitMutex(&pool->mutex);
+        InitCondition(&pool->taskAvailable);
+        InitCondition(&pool->taskCompleted);
+
+        pool->threads = (rpcThread *)RL_CALLOC(threadCount, sizeof(rpcThread));
+
+        for (int i = 0; i < threadCount; i++)
+        {
+            bool created = false;
+#if defined(_WIN32)
+            pool->threads[i] = CreateThread(NULL, 0, WorkerThreadEntry, pool, 0, NULL);
+            created = (pool->threads[i] != NULL);
+#else
+            created = (pthread_create(&pool->threads[i], NULL, WorkerThreadEntry, pool) == 0);
+#endif
+            if (!created) break;
+
+            pool->threadCount++;
+        }
+
+        if (pool->threadCount < threadCount) LOG("WARNING: Only %i/%i worker threads could be created\n", pool->threadCount, threadCount);
+    }
+#endif
+
+    return pool;
+}
+
+// Unload worker threads pool
+// WARNING: Current tasks batch must be completed (WaitWorkerTasks())
+static void UnloadWorkerPool(WorkerPool *pool)
+{
+    if (pool == NULL) return;
+
+#if !defined(RPC_NO_THREADS)
+    if (pool->threadCount > 0)
+    {
+        LockMutex(&pool->mutex);
+        pool->closing = true;
+        BroadcastCondition(&pool->taskAvailable);
+        UnlockMutex(&pool->mutex);
+
+        for (int i = 0; i < pool->threadCount; i++)
+        {
+#if defined(_WIN32)
+            WaitForSingleObject(pool->threads[i], 0xffffffff);
+            CloseHandle(pool->threads[i]);
+#else
+            pthread_join(pool->threads[i], NULL);
+#endif
+        }
+
+        DestroyCondition(&pool->taskCompleted);
+        DestroyCondition(&pool->taskAvailable);
+        DestroyMutex(&pool->mutex);
+    }
+
+    RL_FREE(pool->threads);
+#endif
+
+    RL_FREE(pool->taskDone);
+    RL_FREE(pool->taskThread);
+    RL_FREE(pool);
+}
+
+// Start processing a tasks batch on worker threads (non-blocking)
+// NOTE: Previous batch must be completed, without pool threads all tasks are processed before returning
+static void RunWorkerTasks(WorkerPool *pool, WorkerTaskCallback callback, void *userData, int taskCount)
+{
+    RL_FREE(pool->taskDone);
+    RL_FREE(pool->taskThread);
+    pool->taskDone = (unsigned char *)RL_CALLOC((taskCount > 0)? taskCount : 1, sizeof(unsigned char));
+    pool->taskThread = (unsigned char *)RL_CALLOC((taskCount > 0)? taskCount : 1, sizeof(unsigned char));
+
+    if (pool->threadCount == 0)
+    {
+        pool->callback = callback;
+        pool->userData = userData;
+        pool->taskCount = taskCount;
+
+        for (int i = 0; i < taskCount; i++) callback(userData, i);
+
+        memset(pool->taskDone, 1, taskCount);
+        pool->nextTask = taskCount;
+        pool->completedCount = taskCount;
+        return;
+    }
+
+#if !defined(RPC_NO_THREADS)
+    LockMutex(&pool->mutex);
+    pool->callback = callback;
+    pool->userData = userData;
+    pool->taskCount = taskCount;
+    pool->nextTask = 0;
+    pool->completedCount = 0;
+    BroadcastCondition(&pool->taskAvailable);
+    UnlockMutex(&pool->mutex);
+#endif
+}
+
+// Wait for one task of current batch to complete
+static void WaitWorkerTask(WorkerPool *pool, int index)
+{
+    if ((index < 0) || (index >= pool->taskCount)) return;
+
+#if !defined(RPC_NO_THREADS)
+    if (pool->threadCount > 0)
+    {
+        LockMutex(&pool->mutex);
+        while (!pool->taskDone[index]) WaitCondition(&pool->taskCompleted, &pool->mutex);
+        UnlockMutex(&pool->mutex);
+    }
+#endif
+}
+
+// Wait for all tasks of current batch to complete
+static void WaitWorkerTasks(WorkerPool *pool)
+{
+#if !defined(RPC_NO_THREADS)
+    if (pool->threadCount > 0)
+    {
+        LockMutex(&pool->mutex);
+        while (pool->completedCount < pool->taskCount) WaitCondition(&pool->taskCompleted, &pool->mutex);
+        UnlockMutex(&pool->mutex);
+    }
+#endif
+}
+
+// Get current batch tasks completed count
+static int GetWorkerTasksCompleted(WorkerPool *pool)
+{
+    int completedCount = 0;
+
+#if !defined(RPC_NO_THREADS)
+    if (pool->threadCount > 0)
+    {
+        LockMutex(&pool->mutex);
+        completedCount = pool->completedCount;
+        UnlockMutex(&pool->mutex);
+    }
+    else completedCount = pool->completedCount;
+#else
+    completedCount = pool->completedCount;
+#endif
+
+    return completedCount;
+}
+
+// Get available processors count
+static int GetProcessorCount(void)
+{
+    int count = 1;
+
+#if defined(RPC_NO_THREADS)
+    count = 1;
+#elif defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+#else
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (count < 1) count = 1;
+
+    return count;
+}
+
+// Memory arena functions
+//------------------------------------------------------------------------------------
+// Load memory arena, blocks allocated on demand
+static MemArena *LoadMemArena(size_t blockSize)
+{
+    MemArena *arena = (MemArena *)RL_CALLOC(1, sizeof(MemArena));
+    arena->blockSize = (blockSize > 0)? blockSize : RPC_GEN_ARENA_BLOCK_SIZE;
+#if !defined(RPC_NO_THREADS)
+    InitMutex(&arena->mutex);
+#endif
+
+    return arena;
+}
+
+// Unload memory arena, all allocations released
+static void UnloadMemArena(MemArena *arena)
+{
+    if (arena == NULL) return;
+
+    for (int i = 0; i < arena->blockCount; i++) RL_FREE(arena->blocks[i].data);
+    RL_FREE(arena->blocks);
+#if !defined(RPC_NO_THREADS)
+    DestroyMutex(&arena->mutex);
+#endif
+    RL_FREE(arena);
+}
+
+// Reset memory arena, all allocations released
+// NOTE: Blocks are kept for next allocations, arena memory is capped to its peak size
+static void ResetMemArena(MemArena *arena)
+{
+    if (arena == NULL) return;
+
+    for (int i = 0; i < arena->blockCount; i++) arena->blocks[i].used = 0;
+    arena->currentBlock = 0;
+    arena->size = 0;
+    arena->allocCount = 0;
+}
+
+// Allocate zero-initialized memory from arena
+// NOTE: Allocations are 16-byte aligned, memory can not be freed individually
+static void *MemArenaAlloc(MemArena *arena, size_t size)
+{
+    size_t alignedSize = (size + 15) & ~(size_t)15;
+    void *result = NULL;
+
+#if !defined(RPC_NO_THREADS)
+    LockMutex(&arena->mutex);
+#endif
+    // Look for a block with enough space available, from current one
+    while ((arena->currentBlock < arena->blockCount) &&
+           ((arena->blocks[arena->currentBlock].used + alignedSize) > arena->blocks[arena->currentBlock].size)) arena->currentBlock++;
+
+    if (arena->currentBlock >= arena->blockCount)
+    {
+        arena->blocks = (MemArenaBlock *)RL_REALLOC(arena->blocks, (arena->blockCount + 1)*sizeof(MemArenaBlock));
+
+        MemArenaBlock *block = &arena->blocks[arena->blockCount];
+        block->size = (alignedSize > arena->blockSize)? alignedSize : arena->blockSize;
+        block->data = (unsigned char *)RL_MALLOC(block->size);
+        block->used = 0;
+
+        arena->currentBlock = arena->blockCount;
+        arena->blockCount++;
+    }
+
+    MemArenaBlock *block = &arena->blocks[arena->currentBlock];
+    result = block->data + block->used;
+    block->used += alignedSize;
+
+    arena->size += alignedSize;
+    if (arena->size > arena->peakSize) arena->peakSize = arena->size;
+    arena->allocCount++;
+    arena->totalAllocCount++;
+#if !defined(RPC_NO_THREADS)
+    UnlockMutex(&arena->mutex);
+#endif
+
+    // NOTE: Blocks memory is reused after reset, always cleared
+    memset(result, 0, size);
+
+    return result;
+}
+
+// Copy text into arena memory
+// NOTE: Returns NULL if text is NULL
+static char *MemArenaCopyText(MemArena *arena, const char *text)
+{
+    char *result = NULL;
+
+    if (text != NULL)
+    {
+        size_t length = strlen(text);
+        result = (char *)MemArenaAlloc(arena, length + 1);
+        memcpy(result, text, length);
+    }
+
+    return result;
+}
+
+// Template cache functions
+//------------------------------------------------------------------------------------
+// Set template cache directory, cache is cleared if changed
+// NOTE: Template files are keyed by path relative to template directory
+static void SetTemplateCacheRoot(const char *rootPath)
+{
+    if (strcmp(templateCache.rootPath, rootPath) != 0)
+    {
+        UnloadTemplateCache();
+        strncpy(templateCache.rootPath, rootPath, 511);
+    }
+}
+
+// Load template file from cache, reloaded if modified (reference added)
+// NOTE: Cached file is validated by modification time and size, a modified file is reloaded
+// and previous text is kept alive until all jobs using it are unloaded,
+// template files not available on disk are extracted from template archive on first use
+// WARNING: Main thread only, jobs on worker threads only access loaded file text
+static TemplateFile *LoadTemplateFile(const char *fileName)
+{
+    int archiveIndex = -1;
+    int archiveSize = 0;
+
+    if (!FileExists(fileName))
+    {
+        archiveIndex = GetTemplateArchiveIndex(fileName);
+        if (!GetTemplateArchiveInfo(archiveIndex, &archiveSize, NULL)) return NULL;
+    }
+
+    // Get cache key, file path relative to template directory
+    const char *key = fileName;
+    int rootLength = (int)strlen(templateCache.rootPath);
+    if ((rootLength > 0) && (strncmp(fileName, templateCache.rootPath, rootLength) == 0) && (fileName[rootLength] == '/')) key = fileName + rootLength + 1;
+
+    long modTime = (archiveIndex < 0)? GetFileModTime(fileName) : 0;
+    int size = (archiveIndex < 0)? GetFileLength(fileName) : archiveSize;
+    int index = -1;
+
+    for (int i = 0; i < templateCache.count; i++)
+    {
+        if (strcmp(templateCache.files[i]->key, key) == 0) { index = i; break; }
+    }
+
+    if ((index >= 0) && ((templateCache.files[index]->modTime != modTime) || (templateCache.files[index]->size != size)))
+    {
+        // Template file modified, cache reference released and entry removed
+        UnloadTemplateFile(templateCache.files[index]);
+        templateCache.files[index] = templateCache.files[templateCache.count - 1];
+        templateCache.count--;
+        index = -1;
+    }
+
+    if (index < 0)
+    {
+        int profileEvent = BeginProfileEvent(TextFormat("Template load: %s", key), "plan");
+        char *text = (archiveIndex < 0)? LoadFileText(fileName) : LoadTemplateArchiveText(archiveIndex);
+        EndProfileEvent(profileEvent, size, 0);
+
+        if (text == NULL) return NULL;
+
+        if (archiveIndex >= 0)
+        {
+            templateCache.archiveLoadCount++;
+            templateCache.archiveLoadSize += size;
+        }
+
+        TemplateFile *file = (TemplateFile *)RL_CALLOC(1, sizeof(TemplateFile));
+        file->key = TextCopyAlloc(key);
+        file->text = text;
+        file->size = size;
+        file->hash = ComputeHashFNV64((const unsigned char *)text, (int)strlen(text));
+        file->modTime = modTime;
+        file->refCount = 1;     // Template cache reference
+
+        if (templateCache.count >= templateCache.capacity)
+        {
+            templateCache.capacity = (templateCache.capacity > 0)? templateCache.capacity*2 : 32;
+            templateCache.files = (TemplateFile **)RL_REALLOC(templateCache.files, templateCache.capacity*sizeof(TemplateFile *));
+        }
+
+        index = templateCache.count;
+        templateCache.files[index] = file;
+        templateCache.count++;
+    }
+
+    templateCache.files[index]->refCount++;
+
+    return templateCache.files[index];
+}
+
+// Unload template file reference, file data is unloaded when not referenced anymore
+static void UnloadTemplateFile(TemplateFile *file)
+{
+    if (file == NULL) return;
+
+    file->refCount--;
+
+    if (file->refCount <= 0)
+    {
+        UnloadFileText(file->text);
+        RL_FREE(file->key);
+        RL_FREE(file);
+    }
+}
+
+// Load project configuration template data (.rpc), copied from cache
+// NOTE: Configuration template is parsed once (including comments) and reparsed if modified,
+// returned data must be unloaded with rini_unload()
+static rini_data LoadTemplateConfigData(const char *fileName)
+{
+    int archiveIndex = FileExists(fileName)? -1 : GetTemplateArchiveIndex(fileName);
+    long modTime = (archiveIndex < 0)? GetFileModTime(fileName) : 0;
+    int size = GetFileLength(fileName);
+    if (archiveIndex >= 0) GetTemplateArchiveInfo(archiveIndex, &size, NULL);
+
+    if ((templateCache.configData.entries == NULL) || (templateCache.configModTime != modTime) || (templateCache.configSize != size))
+    {
+        if (templateCache.configData.entries != NULL) rini_unload(&templateCache.configData);
+
+        int profileEvent = BeginProfileEvent("Template load: project_name.rpc", "plan");
+        if (archiveIndex >= 0)
+        {
+            // NOTE: rini_load_full() only loads from file, archived configuration template is saved to a temporary file
+            TemplateFile *file = LoadTemplateFile(fileName);
+            char tempFileName[RPC_MAX_PATH_LENGTH] = { 0 };
+            strcpy(tempFileName, GetTempFilePath("project_name.rpc"));
+
+            if ((file != NULL) && SaveFileText(tempFileName, file->text)) templateCache.configData = rini_load_full(tempFileName);
+            else templateCache.configData = rini_load_full(NULL);
+
+            remove(tempFileName);
+            UnloadTemplateFile(file);
+        }
+        else templateCache.configData = rini_load_full(fileName);
+        EndProfileEvent(profileEvent, size, 0);
+
+        templateCache.configModTime = modTime;
+        templateCache.configSize = size;
+    }
+
+    // NOTE: rini data entries are plain data, copied directly
+    rini_data data = templateCache.configData;
+    data.entries = (rini_entry *)RINI_CALLOC(data.capacity, sizeof(rini_entry));
+    memcpy(data.entries, templateCache.configData.entries, data.count*sizeof(rini_entry));
+
+    return data;
+}
+
+// Get precompiled template for template file and replacements table
+// NOTE: Precompiled template is only valid for the same template text and patterns (in same order)
+static const CompiledTemplate *GetCompiledTemplate(const TemplateFile *file, const TextReplacement *replacements, int count)
+{
+    if (file == NULL) return NULL;
+
+    for (int i = 0; i < compiledTemplateCount; i++)
+    {
+        const CompiledTemplate *compiled = &compiledTemplates[i];
+
+        if ((compiled->size == file->size) && (compiled->hash == file->hash) &&
+            (compiled->patternCount == count) && (strcmp(compiled->key, file->key) == 0))
+        {
+            bool match = true;
+            for (int p = 0; p < count; p++)
+            {
+                if (strcmp(compiled->patterns[p], (replacements[p].pattern != NULL)? replacements[p].pattern : "") != 0) { match = false; break; }
+            }
+
+            if (match) return compiled;
+        }
+    }
+
+    return NULL;
+}
+
+// Load project configuration template (.rpc), from template archive if not available on disk
+// NOTE: rpcLoadProjectConfig() only loads from file, archived configuration template is saved to a temporary file
+static rpcProjectConfig LoadTemplateProjectConfig(void)
+{
+    const char *fileName = "template/project_name.rpc";
+    int archiveIndex = FileExists(fileName)? -1 : GetTemplateArchiveIndex(fileName);
+
+    if (archiveIndex < 0) return rpcLoadProjectConfig(fileName);
+
+    rpcProjectConfig config = { 0 };
+    char *text = LoadTemplateArchiveText(archiveIndex);
+
+    if (text != NULL)
+    {
+        char tempFileName[RPC_MAX_PATH_LENGTH] = { 0 };
+        strcpy(tempFileName, GetTempFilePath("project_name.rpc"));
+
+        if (SaveFileText(tempFileName, text)) config = rpcLoadProjectConfig(tempFileName);
+        remove(tempFileName);
+
+        RL_FREE(text);
+    }
+
+    return config;
+}
+
+// Get temporary file path, in system temporary directory
+// NOTE: File name is prefixed with current time and clock to avoid collisions
+static const char *GetTempFilePath(const char *fileName)
+{
+#if defined(_WIN32)
+    const char *tempPath = getenv("TEMP");
+    if (tempPath == NULL) tempPath = ".";
+#else
+    const char *tempPath = getenv("TMPDIR");
+    if (tempPath == NULL) tempPath = "/tmp";
+#endif
+
+    return TextFormat("%s/rpc_%u_%u_%s", tempPath, (unsigned int)time(NULL), (unsigned int)clock(), fileName);
+}
+
+// Template provider functions
+//------------------------------------------------------------------------------------
+#if defined(BUILD_TEMPLATE_INTO_EXE)
+// Load template provider from package attached to file (executable)
+static bool LoadTemplateProviderPack(const char *fileName)
+{
+    PackFile pack = LoadPackFile(fileName);
+    if (pack.pack.data == NULL) return false;
+
+    UnloadTemplateProvider();
+    templateProvider.type = TEMPLATE_PROVIDER_PACK;
+    templateProvider.pack = pack;
+
+    return true;
+}
+#endif
+
+// Load template provider from zip archive data, data must be kept while used
+// NOTE: Only zip central directory is read, sorted by miniz for entries lookup by file path,
+// template files can be at archive root or inside a "template/" directory
+static bool LoadTemplateProviderZip(const unsigned char *data, int dataSize)
+{
+    if (data == NULL) return false;
+
+    // NOTE: Zip reader state references reader, it can not be copied once initialized
+    mz_zip_archive *zip = (mz_zip_archive *)RL_CALLOC(1, sizeof(mz_zip_archive));
+
+    if (!mz_zip_reader_init_mem(zip, data, (size_t)dataSize, 0))
+    {
+        RL_FREE(zip);
+        return false;
+    }
+
+    const char *rootPath = NULL;
+    if (mz_zip_reader_locate_file(zip, "project_name.rpc", NULL, MZ_ZIP_FLAG_CASE_SENSITIVE) >= 0) rootPath = "";
+    else if (mz_zip_reader_locate_file(zip, "template/project_name.rpc", NULL, MZ_ZIP_FLAG_CASE_SENSITIVE) >= 0) rootPath = "template/";
+
+    if (rootPath == NULL)
+    {
+        LOG("WARNING: Template zip archive does not contain a project template\n");
+        mz_zip_reader_end(zip);
+        RL_FREE(zip);
+        return false;
+    }
+
+    UnloadTemplateProvider();
+    templateProvider.type = TEMPLATE_PROVIDER_ZIP;
+    templateProvider.zip = zip;
+    strcpy(templateProvider.zipRootPath, rootPath);
+
+    return true;
+}
+
+// Load template provider from zip archive file
+// NOTE: Archive file data is loaded once, entries are extracted from memory (worker threads safe)
+static bool LoadTemplateProviderZipFile(const char *fileName)
+{
+    int dataSize = 0;
+    unsigned char *data = LoadFileData(fileName, &dataSize);
+
+    if (!LoadTemplateProviderZip(data, dataSize))
+    {
+        LOG("WARNING: Template zip archive could not be loaded: %s\n", fileName);
+        UnloadFileData(data);
+        return false;
+    }
+
+    templateProvider.zipData = data;
+
+    return true;
+}
+
+// Unload template provider, directory provider set
+static void UnloadTemplateProvider(void)
+{
+    if (templateProvider.zip != NULL) mz_zip_reader_end(templateProvider.zip);
+    RL_FREE(templateProvider.zip);
+    UnloadFileData(templateProvider.zipData);
+    UnloadPackFile(&templateProvider.pack);
+
+    memset(&templateProvider, 0, sizeof(TemplateProvider));
+}
+
+// Get template file path in template archive (NULL if not a template file)
+// NOTE: Template files are provided relative to template directory or as "template/..." paths
+static const char *GetTemplateArchivePath(const char *fileName)
+{
+    int rootLength = (int)strlen(templateCache.rootPath);
+
+    if ((rootLength > 0) && (strncmp(fileName, templateCache.rootPath, rootLength) == 0) && (fileName[rootLength] == '/')) return fileName + rootLength + 1;
+    if (strncmp(fileName, "template/", 9) == 0) return fileName + 9;
+
+    return NULL;
+}
+
+// Get template file entry index in template archive (-1 if not found)
+// NOTE: Directory provider has no archive, template files are only available on disk
+static int GetTemplateArchiveIndex(const char *fileName)
+{
+    const char *archivePath = GetTemplateArchivePath(fileName);
+    if (archivePath == NULL) return -1;
+
+    int index = -1;
+
+    if (templateProvider.type == TEMPLATE_PROVIDER_PACK) index = GetPackEntryIndex(&templateProvider.pack.pack, archivePath);
+    else if (templateProvider.type == TEMPLATE_PROVIDER_ZIP)
+    {
+        char zipPath[RPC_MAX_PATH_LENGTH] = { 0 };
+        snprintf(zipPath, RPC_MAX_PATH_LENGTH, "%s%s", templateProvider.zipRootPath, archivePath);
+        index = mz_zip_reader_locate_file(templateProvider.zip, zipPath, NULL, MZ_ZIP_FLAG_CASE_SENSITIVE);
+    }
+
+    return index;
+}
+
+// Get template archive entries count
+static int GetTemplateArchiveCount(void)
+{
+    int count = 0;
+
+    if (templateProvider.type == TEMPLATE_PROVIDER_PACK) count = templateProvider.pack.pack.entryCount;
+    else if (templateProvider.type == TEMPLATE_PROVIDER_ZIP) count = (int)mz_zip_reader_get_num_files(templateProvider.zip);
+
+    return count;
+}
+
+// Get template archive entry file size and CRC32
+static bool GetTemplateArchiveInfo(int index, int *size, unsigned int *crc32)
+{
+    if ((index < 0) || (index >= GetTemplateArchiveCount())) return false;
+
+    int fileSize = 0;
+    unsigned int fileCrc32 = 0;
+
+    if (templateProvider.type == TEMPLATE_PROVIDER_PACK)
+    {
+        fileSize = templateProvider.pack.pack.entries[index].fileSize;
+        fileCrc32 = templateProvider.pack.pack.entries[index].crc32;
+    }
+    else
+    {
+        mz_zip_archive_file_stat stat = { 0 };
+        if (!mz_zip_reader_file_stat(templateProvider.zip, (mz_uint)index, &stat) || stat.m_is_directory || (stat.m_uncomp_size > 0x7fffffff)) return false;
+
+        fileSize = (int)stat.m_uncomp_size;
+        fileCrc32 = stat.m_crc32;
+    }
+
+    if (size != NULL) *size = fileSize;
+    if (crc32 != NULL) *crc32 = fileCrc32;
+
+    return true;
+}
+
+// Load template archive entry file as text (null terminated)
+// NOTE: Entry data is validated with its CRC32
+static char *LoadTemplateArchiveText(int index)
+{
+    char *text = NULL;
+    int size = 0;
+
+    if (!GetTemplateArchiveInfo(index, &size, NULL)) return NULL;
+
+    if (templateProvider.type == TEMPLATE_PROVIDER_PACK) text = LoadFileTextPack(templateProvider.pack.pack.entries[index].filePath, &templateProvider.pack.pack);
+    else
+    {
+        text = (char *)RL_CALLOC(size + 1, 1);
+
+        if (!mz_zip_reader_extract_to_mem(templateProvider.zip, (mz_uint)index, text, (size_t)size, 0))
+        {
+            LOG("WARNING: File not extracted properly from template zip archive: %i\n", index);
+            RL_FREE(text);
+            text = NULL;
+        }
+    }
+
+    return text;
+}
+
+// Template zip archive file extraction callback, data written to output file
+// NOTE: Output hash is computed by chunks, extraction fails if chunks are not sequential
+static size_t WriteZipExtractOutput(void *userData, mz_uint64 offset, const void *data, size_t size)
+{
+    ZipExtractOutput *output = (ZipExtractOutput *)userData;
+    if (offset != output->size) return 0;
+
+    output->hash = UpdateHashFNV64(output->hash, (const unsigned char *)data, (int)size);
+    output->size += size;
+
+    return fwrite(data, 1, size, output->file);
+}
+
+// Extract template archive entry to output file, streamed
+// NOTE: Memory required does not depend on file size, data validated with entry CRC32
+// WARNING: Called from worker threads, raylib functions using internal static buffers can not be used
+static bool ExtractTemplateArchiveFile(int index, const char *filePath, unsigned long long *hash)
+{
+    if (templateProvider.type == TEMPLATE_PROVIDER_PACK) return UnpackPackFile(&templateProvider.pack.pack, index, filePath, hash);
+
+    if (hash != NULL) *hash = 0;
+    if (templateProvider.type != TEMPLATE_PROVIDER_ZIP) return false;
+
+    ZipExtractOutput output = { 0 };
+    output.file = fopen(filePath, "wb");
+    output.hash = 0xcbf29ce484222325ULL;
+    if (output.file == NULL) return false;
+
+    bool result = mz_zip_reader_extract_to_callback(templateProvider.zip, (mz_uint)index, WriteZipExtractOutput, &output, 0);
+
+    if (fclose(output.file) != 0) result = false;
+    if (!result) remove(filePath);
+    else if (hash != NULL) *hash = output.hash;
+
+    return result;
+}
+
+// Unload template cache, all template files
+// NOTE: Files still referenced by generation jobs are unloaded with the jobs
+static void UnloadTemplateCache(void)
+{
+    for (int i = 0; i < templateCache.count; i++) UnloadTemplateFile(templateCache.files[i]);
+    RL_FREE(templateCache.files);
+
+    if (templateCache.configData.entries != NULL) rini_unload(&templateCache.configData);
+
+    memset(&templateCache, 0, sizeof(TemplateCache));
+}
+
+// Path builder functions
+//------------------------------------------------------------------------------------
+// Set builder root path, sub path joined with '/' if provided
+// NOTE: Root path text can be a previous builder path, it is copied
+static void SetPathRoot(PathBuilder *builder, const char *root, const char *subPath)
+{
+    char rootPath[RPC_MAX_PATH_LENGTH] = { 0 };
+    strncpy(rootPath, root, RPC_MAX_PATH_LENGTH - 1);
+
+    builder->length = 0;
+    builder->path[0] = '\0';
+    AppendPathText(builder, rootPath);
+
+    if (subPath != NULL)
+    {
+        AppendPathText(builder, "/");
+        AppendPathText(builder, subPath);
+    }
+
+    builder->rootLength = builder->length;
+}
+
+// Build path from builder root, components are concatenated after root separator '/'
+// NOTE: Components list must be NULL-terminated, separators between components must be provided,
+// root path is returned if no component is provided
+// WARNING: Returned path is builder text, valid until next path is built from same builder
+static const char *BuildPath(PathBuilder *builder, const char *component, ...)
+{
+    builder->length = builder->rootLength;
+    builder->path[builder->length] = '\0';
+
+    if (component != NULL)
+    {
+        AppendPathText(builder, "/");
+
+        va_list args;
+        va_start(args, component);
+        for (const char *text = component; text != NULL; text = va_arg(args, const char *)) AppendPathText(builder, text);
+        va_end(args);
+    }
+
+    return builder->path;
+}
+
+// Append text to builder path, truncated to RPC_MAX_PATH_LENGTH
+static void AppendPathText(PathBuilder *builder, const char *text)
+{
+    int length = (int)strlen(text);
+
+    if ((builder->length + length) >= RPC_MAX_PATH_LENGTH)
+    {
+        LOG("WARNING: Path truncated, longer than %i characters: %s\n", RPC_MAX_PATH_LENGTH - 1, builder->path);
+        length = RPC_MAX_PATH_LENGTH - 1 - builder->length;
+    }
+
+    memcpy(builder->path + builder->length, text, length);
+    builder->length += length;
+    builder->path[builder->length] = '\0';
+}
+
+// Project generation jobs functions
+//------------------------------------------------------------------------------------
+// Copy text into a new allocated buffer
+// NOTE: Returns NULL if text is NULL
+static char *TextCopyAlloc(const char *text)
+{
+    char *result = NULL;
+
+    if (text != NULL)
+    {
+        int length = (int)strlen(text);
+        result = (char *)RL_MALLOC(length + 1);
+        memcpy(result, text, length + 1);
+    }
+
+    return result;
+}
+
+// Add job to list, returns job index
+// NOTE: Provided texts are copied into list arena, TextFormat() results can be used
+static int AddGenJob(GenJobList *list, int type, const char *srcPath, const char *dstPath, const char *log)
+{
+    if (list->count >= list->capacity)
+    {
+        list->capacity = (list->capacity > 0)? list->capacity*2 : 64;
+        list->jobs = (GenJob *)RL_REALLOC(list->jobs, list->capacity*sizeof(GenJob));
+    }
+
+    GenJob *job = &list->jobs[list->count];
+    memset(job, 0, sizeof(GenJob));
+
+    job->type = type;
+    job->dependency = -1;
+    job->archiveIndex = -1;
+    job->arena = list->arena;
+    job->srcPath = MemArenaCopyText(list->arena, srcPath);
+    job->dstPath = MemArenaCopyText(list->arena, dstPath);
+    job->log = MemArenaCopyText(list->arena, log);
+
+    // NOTE: Template files not available on disk are extracted from template archive on job processing,
+    // only files required by the selected template and build systems are extracted
+    if (((type == GEN_JOB_COPY) || (type == GEN_JOB_LINK) || (type == GEN_JOB_SYMLINK)) &&
+        (templateProvider.type != TEMPLATE_PROVIDER_DIRECTORY) && !FileExists(job->srcPath))
+    {
+        int archiveIndex = GetTemplateArchiveIndex(job->srcPath);
+        unsigned int crc32 = 0;
+
+        if (GetTemplateArchiveInfo(archiveIndex, &job->srcSize, &crc32))
+        {
+            // NOTE: Archived files have no modification time, entry CRC32 is used to detect source data changes
+            job->archiveIndex = archiveIndex;
+            job->srcModTime = (long)crc32;
+            job->type = GEN_JOB_COPY;    // Archived files can not be linked
+        }
+    }
+
+    list->count++;
+
+    return list->count - 1;
+}
+
+// Add template render job, text replacements are resolved and copied
+static void AddGenRenderJob(GenJobList *list, const char *srcPath, const char *dstPath, const TextReplacement *replacements, int count)
+{
+    // NOTE: Paths are copied before any TextFormat() call could overwrite them
+    GenJob *job = &list->jobs[AddGenJob(list, GEN_JOB_RENDER, srcPath, dstPath, NULL)];
+
+    // NOTE: Template text is loaded on main thread from template cache
+    job->templateFile = LoadTemplateFile(job->srcPath);
+    job->compiled = GetCompiledTemplate(job->templateFile, replacements, count);
+
+    // NOTE: Text matcher is built on main thread, once per patterns table, shared by all jobs using it
+    const char **patterns = (const char **)RL_CALLOC((count > 0)? count : 1, sizeof(const char *));
+    for (int i = 0; i < count; i++) patterns[i] = replacements[i].pattern;
+    job->matcher = LoadTextMatcher(patterns, count);
+    RL_FREE(patterns);
+
+    // NOTE: Replacement texts are resolved once per job, rendering only copies them
+    job->replacements = ResolveTextReplacements(job->matcher, replacements, list->arena);
+    job->replacementCount = job->matcher->count;
+}
+
+// Unload jobs list data
+// NOTE: Jobs data is released with list arena
+static void UnloadGenJobs(GenJobList *list)
+{
+    for (int i = 0; i < list->count; i++) UnloadTemplateFile(list->jobs[i].templateFile);
+
+    RL_FREE(list->jobs);
+    list->jobs = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+// Add output directory to plan directories tree, returns directory job index
+// NOTE: Missing directories are added in parent-first order, directories already planned are reused,
+// directory out of any tree root is added as a new tree root (created with full path)
+static int AddGenDirectory(GenPlan *plan, const char *dirPath)
+{
+    GenDirTree *tree = &plan->dirTree;
+    int length = (int)strlen(dirPath);
+    while ((length > 1) && ((dirPath[length - 1] == '/') || (dirPath[length - 1] == '\\'))) length--;
+
+    // Find tree root containing directory, longest root path is kept
+    int node = -1;
+    int offset = 0;
+
+    for (int i = 0; i < tree->count; i++)
+    {
+        if (tree->nodes[i].parent >= 0) continue;
+
+        const char *rootPath = plan->dirJobs.jobs[i].dstPath;
+        int rootLength = (int)strlen(rootPath);
+
+        if ((rootLength <= length) && (rootLength > offset) && (strncmp(rootPath, dirPath, rootLength) == 0) &&
+            ((rootLength == length) || (dirPath[rootLength] == '/') || (dirPath[rootLength] == '\\')))
+        {
+            node = i;
+            offset = rootLength;
+        }
+    }
+
+    if (node < 0) return AddGenDirectoryNode(plan, -1, dirPath, length, 0);
+
+    // Walk directory path components from tree root, missing subdirectories added
+    while (offset < length)
+    {
+        int start = offset;
+        while ((start < length) && ((dirPath[start] == '/') || (dirPath[start] == '\\'))) start++;
+
+        int end = start;
+        while ((end < length) && (dirPath[end] != '/') && (dirPath[end] != '\\')) end++;
+
+        if (end == start) break;
+
+        int child = tree->nodes[node].firstChild;
+
+        while (child >= 0)
+        {
+            const char *name = plan->dirJobs.jobs[child].dstPath + tree->nodes[child].nameOffset;
+            if ((strncmp(name, dirPath + start, end - start) == 0) && (name[end - start] == '\0')) break;
+
+            child = tree->nodes[child].nextSibling;
+        }
+
+        if (child < 0) child = AddGenDirectoryNode(plan, node, dirPath, end, start);
+
+        node = child;
+        offset = end;
+    }
+
+    return node;
+}
+
+// Add directory node and job to plan directories tree, returns directory job index
+// NOTE: Directory job depends on parent directory job, directory path is provided path first length characters
+static int AddGenDirectoryNode(GenPlan *plan, int parent, const char *dirPath, int length, int nameOffset)
+{
+    GenDirTree *tree = &plan->dirTree;
+    char path[RPC_MAX_PATH_LENGTH] = { 0 };
+
+    if (length >= RPC_MAX_PATH_LENGTH)
+    {
+        LOG("WARNING: Directory path too long, truncated: %s\n", dirPath);
+        length = RPC_MAX_PATH_LENGTH - 1;
+    }
+
+    memcpy(path, dirPath, length);
+
+    if (tree->count >= tree->capacity)
+    {
+        tree->capacity = (tree->capacity > 0)? tree->capacity*2 : 32;
+        tree->nodes = (GenDirNode *)RL_REALLOC(tree->nodes, tree->capacity*sizeof(GenDirNode));
+    }
+
+    int index = AddGenJob(&plan->dirJobs, GEN_JOB_MKDIR, NULL, path, NULL);
+    plan->dirJobs.jobs[index].dependency = parent;
+
+    GenDirNode *node = &tree->nodes[index];
+    node->parent = parent;
+    node->firstChild = -1;
+    node->nextSibling = -1;
+    node->nameOffset = nameOffset;
+
+    if (parent >= 0)
+    {
+        node->nextSibling = tree->nodes[parent].firstChild;
+        tree->nodes[parent].firstChild = index;
+    }
+
+    tree->count++;
+
+    return index;
+}
+
+// Create one directory, parent directory must exist
+// NOTE: Directory already existing is not considered a failure, no path components are checked
+static bool MakeDirectoryEntry(const char *dirPath)
+{
+#if defined(PLATFORM_WEB)
+    return (MakeDirectory(dirPath) == 0);
+#elif defined(_WIN32)
+    return (CreateDirectoryA(dirPath, NULL) != 0) || (GetLastError() == 183);   // ERROR_ALREADY_EXISTS
+#else
+    return (mkdir(dirPath, 0755) == 0) || (errno == EEXIST);
+#endif
+}
+
+// Remove one directory, only removed if empty
+// NOTE: Directories are not removed on web platform, output is packed on generation
+static bool RemoveDirectoryEntry(const char *dirPath)
+{
+#if defined(PLATFORM_WEB)
+    (void)dirPath;
+    return false;
+#elif defined(_WIN32)
+    return (RemoveDirectoryA(dirPath) != 0);
+#else
+    return (rmdir(dirPath) == 0);
+#endif
+}
+
+// Check if output file is the same registered on previous generation manifest
+// NOTE: Output files modified by user after generation are considered changed
+static bool IsGenOutputUnchanged(const GenManifestEntry *entry, const char *outPath)
+{
+    return (FileExists(outPath) && (GetFileLength(outPath) == entry->outSize) && (GetFileModTime(outPath) == entry->outModTime));
+}
+
+// Process one generation job, worker task callback
+// WARNING: Called from worker threads, raylib functions using internal static buffers
+// (TextFormat(), TextReplace(), GetFileName(), GetDirectoryPath(), FileCopy()...) can not be used
+static void ProcessGenJob(void *userData, int index)
+{
+    GenJob *job = GetGenBatchJob((GenJobBatch *)userData, index);
+
+    if (profiler.enabled) job->startTime = GetProfileTime();
+
+    switch (job->type)
+    {
+        case GEN_JOB_MKDIR: job->failed = (job->dependency < 0)? (MakeDirectory(job->dstPath) != 0) : !MakeDirectoryEntry(job->dstPath); break;
+        case GEN_JOB_COPY:
+        {
+            // NOTE: Archived files size and CRC32 (as modification time) already set on job creation
+            if (job->archiveIndex < 0)
+            {
+                if (!FileExists(job->srcPath)) { job->failed = true; break; }
+
+                job->srcSize = GetFileLength(job->srcPath);
+                job->srcModTime = GetFileModTime(job->srcPath);
+            }
+
+            // Skip copy if source file did not change since previous generation
+            const GenManifestEntry *prev = job->prevEntry;
+            if ((prev != NULL) && (prev->type == GEN_JOB_COPY) && (strcmp(prev->srcPath, job->srcPath) == 0) &&
+                (prev->srcSize == job->srcSize) && (prev->srcModTime == job->srcModTime) && IsGenOutputUnchanged(prev, job->dstPath))
+            {
+                job->hash = prev->hash;
+                job->skipped = true;
+            }
+            else if ((job->archiveIndex < 0) && IsSameFilePath(job->srcPath, job->dstPath))
+            {
+                // Source file already at destination path, nothing to copy
+                job->hash = ComputeFileHashFNV64(job->srcPath);
+                job->skipped = true;
+            }
+            else
+            {
+                // WARNING: Destination linked to source must be unlinked first, copying over it would truncate source file data
+                if (((prev != NULL) && (prev->type >= GEN_JOB_LINK)) ||
+                    IsFileLinked(job->srcPath, job->dstPath, false) || IsFileLinked(job->srcPath, job->dstPath, true)) remove(job->dstPath);
+
+                if (job->archiveIndex >= 0) job->failed = !ExtractTemplateArchiveFile(job->archiveIndex, job->dstPath, &job->hash);
+                else job->failed = !CopyFileData(job->srcPath, job->dstPath, &job->hash);
+            }
+
+        } break;
+        case GEN_JOB_RENDER:
+        {
+            // NOTE: Template text already loaded from template cache, no file read required
+            if (job->templateFile != NULL)
+            {
+                job->srcSize = job->templateFile->size;
+                job->srcModTime = job->templateFile->modTime;
+
+                // NOTE: Generated text is allocated from plan arena, released with plan
+                char *fileTextUpdated = TextReplaceTemplate(job->templateFile->text, job->matcher, job->replacements, job->compiled, job->arena);
+                job->hash = ComputeHashFNV64((const unsigned char *)fileTextUpdated, (int)strlen(fileTextUpdated));
+
+                // Skip saving if generated text is the same as previous generation
+                // NOTE: Replacement values changes are detected by generated text hash
+                const GenManifestEntry *prev = job->prevEntry;
+                if ((prev != NULL) && (prev->type == GEN_JOB_RENDER) && (prev->hash == job->hash) && IsGenOutputUnchanged(prev, job->dstPath)) job->skipped = true;
+                else job->failed = !SaveFileText(job->dstPath, fileTextUpdated);
+            }
+            else job->failed = true;
+
+        } break;
+        case GEN_JOB_LINK:
+        case GEN_JOB_SYMLINK:
+        {
+            if (!FileExists(job->srcPath)) { job->failed = true; break; }
+
+            job->srcSize = GetFileLength(job->srcPath);
+            job->srcModTime = GetFileModTime(job->srcPath);
+
+            // Skip linking if destination is already linked to source file or it is the source file itself
+            // NOTE: Hardlink jobs also accept symlinks, created if crossing file systems
+            if (IsSameFilePath(job->srcPath, job->dstPath) || IsFileLinked(job->srcPath, job->dstPath, true) ||
+                ((job->type == GEN_JOB_LINK) && IsFileLinked(job->srcPath, job->dstPath, false))) job->skipped = true;
+            else if (!LinkFileData(job->srcPath, job->dstPath, (job->type == GEN_JOB_SYMLINK)))
+            {
+                // Fallback: Copy file if link could not be created
+                job->type = GEN_JOB_COPY;
+                job->linkFailed = true;
+                job->failed = !CopyFileData(job->srcPath, job->dstPath, &job->hash);
+            }
+
+        } break;
+        default: break;
+    }
+
+    // Register output file state for manifest
+    // NOTE: Linked outputs report source file state, links are checked again on next generation
+    if (!job->failed && (job->type >= GEN_JOB_COPY))
+    {
+        if (job->skipped && (job->prevEntry != NULL) && (job->type <= GEN_JOB_RENDER))
+        {
+            job->outSize = job->prevEntry->outSize;
+            job->outModTime = job->prevEntry->outModTime;
+        }
+        else
+        {
+            job->outSize = GetFileLength(job->dstPath);
+            job->outModTime = GetFileModTime(job->dstPath);
+        }
+    }
+
+    if (profiler.enabled) job->endTime = GetProfileTime();
+}
+
+// Get job from jobs lists batch, index counts jobs through all lists
+static GenJob *GetGenBatchJob(const GenJobBatch *batch, int index)
+{
+    for (int i = 0; i < batch->count; i++)
+    {
+        if (index < batch->lists[i]->count) return &batch->lists[i]->jobs[index];
+        index -= batch->lists[i]->count;
+    }
+
+    return NULL;
+}
+
+// Process jobs lists as a single tasks batch, logging results in jobs order
+// NOTE: Jobs are processed in parallel but logs are printed in lists order as jobs complete,
+// multiple lists (multiple projects) share available worker threads
+static void RunGenJobs(GenJobList **lists, int count, WorkerPool *pool)
+{
+    GenJobBatch batch = { lists, count };
+    int jobCount = 0;
+    for (int i = 0; i < count; i++) jobCount += lists[i]->count;
+
+    RunWorkerTasks(pool, ProcessGenJob, &batch, jobCount);
+
+    for (int i = 0; i < jobCount; i++)
+    {
+        WaitWorkerTask(pool, i);
+
+        GenJob *job = GetGenBatchJob(&batch, i);
+        if (job->log != NULL) LOG("%s", job->log);
+
+        if (job->linkFailed) LOG("WARNING: Failed to link file, copied instead: %s\n", job->dstPath);
+
+        if (job->failed)
+        {
+            if (job->type == GEN_JOB_MKDIR) LOG("WARNING: Failed to create directory: %s\n", job->dstPath);
+            else LOG("WARNING: Failed to generate file: %s\n", job->dstPath);
+        }
+    }
+
+    WaitWorkerTasks(pool);
+}
+
+// Set plan jobs dependencies and estimated output sizes
+// NOTE: Job depends on the directory job creating its output directory, output directories
+// not planned yet are added to directories tree, all directories are known before any file is written
+static void SetGenPlanDependencies(GenPlan *plan)
+{
+    for (int i = -1; i < plan->fileJobs.count; i++)
+    {
+        GenJob *job = (i < 0)? &plan->configJob : &plan->fileJobs.jobs[i];
+        if (job->dstPath == NULL) continue;
+
+        const char *dirEnd = strrchr(job->dstPath, '/');
+
+        if (dirEnd != NULL)
+        {
+            char dirPath[RPC_MAX_PATH_LENGTH] = { 0 };
+            int dirLength = (int)(dirEnd - job->dstPath);
+            if (dirLength >= RPC_MAX_PATH_LENGTH) dirLength = RPC_MAX_PATH_LENGTH - 1;
+            memcpy(dirPath, job->dstPath, dirLength);
+
+            // NOTE: Directories added for the job are assigned to job section
+            int dirCount = plan->dirJobs.count;
+            job->dependency = AddGenDirectory(plan, dirPath);
+            for (int d = dirCount; d < plan->dirJobs.count; d++) plan->dirJobs.jobs[d].section = job->section;
+        }
+
+        // Estimated output size: source file size, links do not write any data
+        if (job->templateFile != NULL) job->size = job->templateFile->size;
+        else if (job->archiveIndex >= 0) job->size = job->srcSize;
+        else if ((job->type != GEN_JOB_LINK) && (job->type != GEN_JOB_SYMLINK) && FileExists(job->srcPath)) job->size = GetFileLength(job->srcPath);
+    }
+}
+
+// Execute project generation plan, writing all outputs
+static void ExecuteGenPlan(GenPlan *plan)
+{
+    WorkerPool *pool = LoadWorkerPool(generationThreadCount);
+    ExecuteGenPlans(plan, 1, pool);
+    UnloadWorkerPool(pool);
+}
+
+// Execute multiple project generation plans, sharing worker threads
+// NOTE: Directories are created first (main thread), then projects configuration files and files in parallel,
+// all plans jobs are processed as a single tasks batch per phase
+static void ExecuteGenPlans(GenPlan *plans, int count, WorkerPool *pool)
+{
+    int executeEvent = BeginProfileEvent("Generation execute", "execute");
+
+    GenJobList **lists = (GenJobList **)RL_CALLOC(count, sizeof(GenJobList *));
+    GenManifest *manifests = (GenManifest *)RL_CALLOC(count, sizeof(GenManifest));
+
+    // Create directories on main thread, in parent-first order
+    // NOTE: Directories are created with one mkdir call each, no worker threads required
+    WorkerPool mainPool = { 0 };
+    int event = BeginProfileEvent("Directories", "execute");
+    for (int i = 0; i < count; i++) lists[i] = &plans[i].dirJobs;
+    RunGenJobs(lists, count, &mainPool);
+    EndProfileEvent(event, 0, 0);
+    for (int i = 0, offset = 0; i < count; offset += plans[i].dirJobs.count, i++) AddGenProfileEvents(&plans[i], &plans[i].dirJobs, mainPool.taskThread + offset);
+    RL_FREE(mainPool.taskDone);
+    RL_FREE(mainPool.taskThread);
+
+    // Save projects configuration files (.rpc) on main thread
+    event = BeginProfileEvent("Project config (.rpc)", "execute");
+    long long configSize = 0;
+    for (int i = 0; i < count; i++)
+    {
+        plans[i].configJob.startTime = GetProfileTime();
+        rini_save(plans[i].configData, plans[i].configJob.dstPath);
+        plans[i].configJob.endTime = GetProfileTime();
+        plans[i].configJob.outSize = GetFileLength(plans[i].configJob.dstPath);
+        configSize += plans[i].configJob.outSize;
+    }
+    EndProfileEvent(event, 0, configSize);
+
+    // Load previous generation manifests, outputs already up to date are skipped
+    event = BeginProfileEvent("Manifest load", "execute");
+    PathBuilder manifestPath = { 0 };
+    for (int i = 0; i < count; i++)
+    {
+        SetPathRoot(&manifestPath, plans[i].projectOutPath, NULL);
+        manifests[i] = LoadGenManifest(BuildPath(&manifestPath, RPC_MANIFEST_FILENAME, NULL));
+        SetGenJobsManifest(&plans[i].fileJobs, &manifests[i], plans[i].projectOutPath);
+    }
+    EndProfileEvent(event, 0, 0);
+
+    event = BeginProfileEvent("Files", "execute");
+    for (int i = 0; i < count; i++) lists[i] = &plans[i].fileJobs;
+    RunGenJobs(lists, count, pool);
+    EndProfileEvent(event, 0, 0);
+    for (int i = 0, offset = 0; i < count; offset += plans[i].fileJobs.count, i++) AddGenProfileEvents(&plans[i], &plans[i].fileJobs, pool->taskThread + offset);
+
+    for (int p = 0; p < count; p++)
+    {
+        GenPlan *plan = &plans[p];
+
+        // Remove outputs not generated anymore and save updated manifest
+        event = BeginProfileEvent("Manifest save", "execute");
+        int removedCount = RemoveGenStaleOutputs(&manifests[p], &plan->dirJobs, &plan->fileJobs, plan->projectOutPath);
+        SetPathRoot(&manifestPath, plan->projectOutPath, NULL);
+        SaveGenManifest(&plan->fileJobs, plan->projectOutPath, BuildPath(&manifestPath, RPC_MANIFEST_FILENAME, NULL));
+        UnloadGenManifest(&manifests[p]);
+        EndProfileEvent(event, 0, 0);
+
+        AddGenSectionsProfileEvents(plan);
+
+        int writtenCount = 0;
+        int skippedCount = 0;
+        for (int i = 0; i < plan->fileJobs.count; i++)
+        {
+            const GenJob *job = &plan->fileJobs.jobs[i];
+
+            if (job->skipped) skippedCount++;
+            else if (!job->failed && (job->type != GEN_JOB_LOG))
+            {
+                writtenCount++;
+
+                // NOTE: Archived files are only counted once extracted, up to date or failed files are not
+                if ((job->type == GEN_JOB_COPY) && (job->archiveIndex >= 0))
+                {
+                    templateCache.archiveLoadCount++;
+                    templateCache.archiveLoadSize += job->srcSize;
+                }
+            }
+        }
+
+        LOG("INFO: Project files: %i written, %i up to date, %i removed\n", writtenCount, skippedCount, removedCount);
+        if (GetTemplateArchiveCount() > 0) LOG("INFO: Template archive files extracted: %i/%i (%i bytes)\n", templateCache.archiveLoadCount, GetTemplateArchiveCount(), templateCache.archiveLoadSize);
+        LOG("INFO: Project generation memory: %i KB, %i allocations\n", (int)(plan->arena->size/1024), plan->arena->allocCount);
+        LOG("INFO: Project generated successfully: %s\n", plan->projectName);
+        LOG("-----------------------------------------------------------------\n");
+    }
+
+    RL_FREE(manifests);
+    RL_FREE(lists);
+
+    EndProfileEvent(executeEvent, 0, 0);
+}
+
+// Unload project generation plan
+// NOTE: Plan memory arena is unloaded if owned by plan, reset otherwise
+static void UnloadGenPlan(GenPlan *plan)
+{
+    UnloadGenJobs(&plan->fileJobs);
+    UnloadGenJobs(&plan->dirJobs);
+    RL_FREE(plan->dirTree.nodes);
+
+    if (plan->valid) rini_unload(&plan->configData);
+
+    if (plan->arenaOwned) UnloadMemArena(plan->arena);
+    else ResetMemArena(plan->arena);
+
+    memset(plan, 0, sizeof(GenPlan));
+}
+
+// Save text as JSON string, escaping required characters
+static void SaveJSONText(FILE *file, const char *text)
+{
+    fputc('"', file);
+
+    for (const char *ptr = (text != NULL)? text : ""; *ptr != '\0'; ptr++)
+    {
+        if ((*ptr == '"') || (*ptr == '\\')) fprintf(file, "\\%c", *ptr);
+        else if ((unsigned char)*ptr < 0x20) fprintf(file, "\\u%04x", (unsigned char)*ptr);
+        else fputc(*ptr, file);
+    }
+
+    fputc('"', file);
+}
+
+// Save project generation plan as JSON
+// NOTE: Operations are listed in processing order, ids are consecutive and dependencies refer to ids,
+// log jobs are not included
+static bool SaveGenPlanJSON(const GenPlan *plan, const char *fileName)
+{
+    static const char *opNames[] = { "log", "mkdir", "write", "copy", "render", "link", "symlink" };
+
+    FILE *file = fopen(fileName, "wt");
+    if (file == NULL) return false;
+
+    long long totalSize = plan->configJob.size;
+    int opCount = plan->dirJobs.count + 1;
+
+    for (int i = 0; i < plan->fileJobs.count; i++)
+    {
+        if (plan->fileJobs.jobs[i].type != GEN_JOB_LOG) { totalSize += plan->fileJobs.jobs[i].size; opCount++; }
+    }
+
+    fprintf(file, "{\n    \"project\": ");
+    SaveJSONText(file, plan->projectName);
+    fprintf(file, ",\n    \"outputPath\": ");
+    SaveJSONText(file, plan->projectOutPath);
+    fprintf(file, ",\n    \"operationCount\": %i,\n    \"estimatedBytes\": %lld,\n    \"operations\": [\n", opCount, totalSize);
+
+    // NOTE: Directory jobs ids are their index, dependencies refer to them directly
+    int totalCount = plan->dirJobs.count + 1 + plan->fileJobs.count;
+
+    for (int i = 0, id = 0; i < totalCount; i++)
+    {
+        const GenJob *job = NULL;
+
+        if (i < plan->dirJobs.count) job = &plan->dirJobs.jobs[i];
+        else if (i == plan->dirJobs.count) job = &plan->configJob;
+        else job = &plan->fileJobs.jobs[i - plan->dirJobs.count - 1];
+
+        if (job->type == GEN_JOB_LOG) continue;
+
+        fprintf(file, "        { \"id\": %i, \"op\": \"%s\", ", id, opNames[job->type]);
+        if (job->srcPath != NULL) { fprintf(file, "\"src\": "); SaveJSONText(file, job->srcPath); fprintf(file, ", "); }
+        fprintf(file, "\"dst\": ");
+        SaveJSONText(file, job->dstPath);
+        if (job->dependency >= 0) fprintf(file, ", \"deps\": [ %i ]", job->dependency);
+        else fprintf(file, ", \"deps\": [ ]");
+        fprintf(file, ", \"bytes\": %i }%s\n", job->size, (id < (opCount - 1))? "," : "");
+
+        id++;
+    }
+
+    fprintf(file, "    ]\n}\n");
+    fclose(file);
+
+    return true;
+}
+
+// Begin plan section, next jobs added are assigned to it
+// NOTE: Section planning time is registered as profile event
+static void BeginGenPlanSection(GenPlan *plan, const char *name)
+{
+    if (plan->sectionCount >= RPC_MAX_GEN_SECTIONS) return;
+
+    plan->sections[plan->sectionCount] = name;
+    plan->sectionDirStart = plan->dirJobs.count;
+    plan->sectionFileStart = plan->fileJobs.count;
+    plan->sectionEvent = BeginProfileEvent(name, "plan");
+}
+
+// End current plan section
+static void EndGenPlanSection(GenPlan *plan)
+{
+    if (plan->sectionCount >= RPC_MAX_GEN_SECTIONS) return;
+
+    for (int i = plan->sectionDirStart; i < plan->dirJobs.count; i++) plan->dirJobs.jobs[i].section = plan->sectionCount;
+    for (int i = plan->sectionFileStart; i < plan->fileJobs.count; i++) plan->fileJobs.jobs[i].section = plan->sectionCount;
+
+    EndProfileEvent(plan->sectionEvent, 0, 0);
+    plan->sectionCount++;
+}
+
+// Get job bytes read and written on processing
+// NOTE: Template files are read from template cache on planning, links do not read or write data
+static void GetGenJobBytes(const GenJob *job, long long *bytesRead, long long *bytesWritten)
+{
+    *bytesRead = 0;
+    *bytesWritten = 0;
+
+    if (job->failed) return;
+
+    if ((job->type == GEN_JOB_COPY) && !job->skipped) *bytesRead = job->srcSize;
+
+    if (((job->type == GEN_JOB_COPY) || (job->type == GEN_JOB_RENDER) || (job->type == GEN_JOB_WRITE)) && !job->skipped) *bytesWritten = job->outSize;
+}
+
+// Add processed jobs profile events, one event per job on its processing thread
+static void AddGenProfileEvents(const GenPlan *plan, const GenJobList *list, const unsigned char *taskThread)
+{
+    if (!profiler.enabled) return;
+
+    static const char *jobNames[] = { "Log", "Mkdir", "Write", "Copy", "Render", "Link", "Symlink" };
+
+    for (int i = 0; i < list->count; i++)
+    {
+        const GenJob *job = &list->jobs[i];
+        if (job->type == GEN_JOB_LOG) continue;
+
+        const char *relativePath = GetGenRelativePath(job->dstPath, plan->projectOutPath);
+        long long bytesRead = 0;
+        long long bytesWritten = 0;
+        GetGenJobBytes(job, &bytesRead, &bytesWritten);
+
+        AddProfileEvent(TextFormat("%s: %s", jobNames[job->type], (relativePath != NULL)? relativePath : job->dstPath),
+            (job->section < plan->sectionCount)? plan->sections[job->section] : "job",
+            taskThread[i], job->startTime, job->endTime, bytesRead, bytesWritten);
+    }
+}
+
+// Add plan sections profile events, including jobs bytes read/written
+// NOTE: Section jobs are processed in parallel with other sections jobs, section event spans
+// from its first job start to its last job end, registered on a separate track
+static void AddGenSectionsProfileEvents(const GenPlan *plan)
+{
+    if (!profiler.enabled) return;
+
+    for (int s = 0; s < plan->sectionCount; s++)
+    {
+        double startTime = -1.0;
+        double endTime = 0.0;
+        long long bytesRead = 0;
+        long long bytesWritten = 0;
+
+        for (int i = -1; i < plan->dirJobs.count + plan->fileJobs.count; i++)
+        {
+            const GenJob *job = (i < 0)? &plan->configJob :
+                (i < plan->dirJobs.count)? &plan->dirJobs.jobs[i] : &plan->fileJobs.jobs[i - plan->dirJobs.count];
+
+            if ((job->section != s) || (job->type == GEN_JOB_LOG)) continue;
+
+            long long jobRead = 0;
+            long long jobWritten = 0;
+            GetGenJobBytes(job, &jobRead, &jobWritten);
+
+            bytesRead += jobRead;
+            bytesWritten += jobWritten;
+            if ((startTime < 0.0) || (job->startTime < startTime)) startTime = job->startTime;
+            if (job->endTime > endTime) endTime = job->endTime;
+        }
+
+        if (startTime >= 0.0) AddProfileEvent(plan->sections[s], "section", RPC_MAX_WORKER_THREADS + 1, startTime, endTime, bytesRead, bytesWritten);
+    }
+}
+
+// Linked assets resolution functions
+//------------------------------------------------------------------------------------
+// Load linked assets resolver, texts allocated from arena
+static LinkedAssetResolver LoadLinkedAssetResolver(MemArena *arena)
+{
+    LinkedAssetResolver resolver = { 0 };
+
+    resolver.arena = arena;
+    resolver.filePaths = (char **)RL_CALLOC(RPC_MAX_LINKED_ASSETS, sizeof(char *));
+    resolver.files = (LinkedAssetFile *)RL_CALLOC(RPC_MAX_LINKED_ASSETS, sizeof(LinkedAssetFile));
+    resolver.fileLookup = (int *)RL_MALLOC(RPC_MAX_LINKED_ASSETS*2*sizeof(int));
+    resolver.dstPaths = (char **)RL_CALLOC(RPC_MAX_LINKED_ASSETS, sizeof(char *));
+    resolver.dstSrcPaths = (char **)RL_CALLOC(RPC_MAX_LINKED_ASSETS, sizeof(char *));
+    resolver.dstLookup = (int *)RL_MALLOC(RPC_MAX_LINKED_ASSETS*2*sizeof(int));
+
+    for (int i = 0; i < RPC_MAX_LINKED_ASSETS*2; i++)
+    {
+        resolver.fileLookup[i] = -1;
+        resolver.dstLookup[i] = -1;
+    }
+
+    return resolver;
+}
+
+// Unload linked assets resolver
+// NOTE: Resolver texts are released with plan arena
+static void UnloadLinkedAssetResolver(LinkedAssetResolver *resolver)
+{
+    RL_FREE(resolver->filePaths);
+    RL_FREE(resolver->files);
+    RL_FREE(resolver->fileLookup);
+    RL_FREE(resolver->dstPaths);
+    RL_FREE(resolver->dstSrcPaths);
+    RL_FREE(resolver->dstLookup);
+
+    memset(resolver, 0, sizeof(LinkedAssetResolver));
+}
+
+// Add destination file planned, relative to assets path (false if already planned)
+// NOTE: Destination planned from a different source file is reported, first source file is kept
+static bool AddLinkedAssetDestination(LinkedAssetResolver *resolver, const char *dstPath, const char *srcPath)
+{
+    int *slot = GetPathLookupSlot(resolver->dstLookup, RPC_MAX_LINKED_ASSETS*2, resolver->dstPaths, dstPath);
+
+    if (*slot >= 0)
+    {
+        if (strcmp(resolver->dstSrcPaths[*slot], srcPath) != 0) LOG("WARNING: Asset file name already used, file not copied: %s\n", srcPath);
+        return false;
+    }
+
+    if (resolver->dstCount >= RPC_MAX_LINKED_ASSETS)
+    {
+        LOG("WARNING: Too many asset files, linked resources not copied: %s\n", dstPath);
+        return false;
+    }
+
+    resolver->dstPaths[resolver->dstCount] = MemArenaCopyText(resolver->arena, dstPath);
+    resolver->dstSrcPaths[resolver->dstCount] = MemArenaCopyText(resolver->arena, srcPath);
+    *slot = resolver->dstCount;
+    resolver->dstCount++;
+
+    return true;
+}
+
+// Get asset file index, asset file parsed on first request (-1 if not available)
+// NOTE: Asset files are parsed once, linked resources paths kept for next requests
+static int GetLinkedAssetFile(LinkedAssetResolver *resolver, const char *filePath)
+{
+    int *slot = GetPathLookupSlot(resolver->fileLookup, RPC_MAX_LINKED_ASSETS*2, resolver->filePaths, filePath);
+
+    if (*slot >= 0) return *slot;
+    if (resolver->fileCount >= RPC_MAX_LINKED_ASSETS) return -1;
+
+    int index = resolver->fileCount;
+    LinkedAssetFile *file = &resolver->files[index];
+
+    resolver->filePaths[index] = MemArenaCopyText(resolver->arena, filePath);
+    *slot = index;
+    resolver->fileCount++;
+
+    char *text = LoadFileText(filePath);
+
+    if (text != NULL)
+    {
+        // NOTE: Linked paths are text fragments, never longer than asset file text
+        int textLength = (int)strlen(text);
+        int linksSize = 0;
+        char *links = (char *)RL_MALLOC(textLength + 1);
+
+        file->linkCount = ParseLinkedAssetPaths(filePath, text, links, &linksSize);
+
+        if (file->linkCount > 0)
+        {
+            file->links = (char *)MemArenaAlloc(resolver->arena, linksSize);
+            memcpy(file->links, links, linksSize);
+        }
+
+        resolver->bytesRead += textLength;
+
+        RL_FREE(links);
+        UnloadFileText(text);
+    }
+
+    return index;
+}
+
+// Add asset file linked resources to generation plan, resolved recursively
+// NOTE: Linked resources keep their path relative to linking file, so references stay valid on destination,
+// destination path is relative to assets path, resources out of assets path are not copied
+static void AddGenLinkedAssets(GenPlan *plan, LinkedAssetResolver *resolver, PathBuilder *assetsRoot, const char *srcPath, const char *dstPath, int jobType, int depth)
+{
+    if (!IsFileExtension(srcPath, ".fnt;.gltf;.obj;.mtl")) return;
+
+    int index = GetLinkedAssetFile(resolver, srcPath);
+    if ((index < 0) || (resolver->files[index].linkCount == 0)) return;
+
+    if (depth >= RPC_MAX_LINKED_DEPTH)
+    {
+        LOG("WARNING: Linked resources nested too deep, not resolved: %s\n", srcPath);
+        return;
     }
-    else if (selTemplate == 2)  // Screen Manager
+
+    resolver->files[index].resolving = true;
+
+    const char *link = resolver->files[index].links;
+
+    for (int i = 0; i < resolver->files[index].linkCount; i++, link += (strlen(link) + 1))
     {
-        strcpy(input->srcFilePaths[0], TextFormat("%s/src_screen_manager/project_name.c", templatePath));
-        strcpy(input->srcFilePaths[1], TextFormat("%s/src_screen_manager/screens.h", templatePath));
-        strcpy(input->srcFilePaths[2], TextFormat("%s/src_screen_manager/screen_logo.c", templatePath));
-        strcpy(input->srcFilePaths[3], TextFormat("%s/src_screen_manager/screen_title.c", templatePath));
-        strcpy(input->srcFilePaths[4], TextFormat("%s/src_screen_manager/screen_options.c", templatePath));
-        strcpy(input->srcFilePaths[5], TextFormat("%s/src_screen_manager/screen_gameplay.c", templatePath));
-        strcpy(input->srcFilePaths[6], TextFormat("%s/src_screen_manager/screen_ending.c", templatePath));
-        input->srcFileCount = 7;
+        // NOTE: Embedded data and remote resources do not require any file
+        if ((strncmp(link, "data:", 5) == 0) || (strstr(link, "://") != NULL)) continue;
 
-        strcpy(input->assetFilePaths[0], TextFormat("%s/src_screen_manager/resources/coin.wav", templatePath));
-        strcpy(input->assetFilePaths[1], TextFormat("%s/src_screen_manager/resources/mecha.png", templatePath));
-        strcpy(input->assetFilePaths[2], TextFormat("%s/src_screen_manager/resources/README", templatePath)); // Assets licence
-        input->assetFileCount = 3;
+        char linkSrcPath[RPC_MAX_PATH_LENGTH] = { 0 };
+        char linkDstPath[RPC_MAX_PATH_LENGTH] = { 0 };
 
-        /*
-        FilePathList pathList = LoadDirectoryFiles(TextFormat("%s/src_screen_manager/resources", templatePath));
-        for (int i = 0; i < pathList.count; i++)
+        if ((link[0] == '/') || (link[0] == '\\') || (link[1] == ':') ||
+            !GetLinkedAssetPath(linkSrcPath, srcPath, link) || !GetLinkedAssetPath(linkDstPath, dstPath, link) ||
+            ((linkDstPath[0] == '.') && (linkDstPath[1] == '.') && ((linkDstPath[2] == '/') || (linkDstPath[2] == '\0'))))
         {
-            strcpy(input->assetFilePaths[i], pathList.paths[i]);
-            input->assetFileCount++;
+            LOG("WARNING: Linked resource out of assets path, not copied: %s (%s)\n", link, srcPath);
+            continue;
         }
-        UnloadDirectoryFiles(pathList);
-        */
-    }
-    else if (selTemplate == 3)  // Platformer 2D
-    {
-        strcpy(input->srcFilePaths[0], TextFormat("%s/src_platformer_2d/project_name.c", templatePath));
-        input->srcFileCount = 1;
 
-        // No assets required
+        // Check linked resource is not linking back to a file being resolved
+        int *slot = GetPathLookupSlot(resolver->fileLookup, RPC_MAX_LINKED_ASSETS*2, resolver->filePaths, linkSrcPath);
+
+        if ((*slot >= 0) && resolver->files[*slot].resolving)
+        {
+            LOG("WARNING: Linked resources cycle found, not resolved: %s (%s)\n", link, srcPath);
+            continue;
+        }
+
+        if (!FileExists(linkSrcPath))
+        {
+            LOG("WARNING: Linked resource not found, not copied: %s (%s)\n", linkSrcPath, srcPath);
+            continue;
+        }
+
+        // NOTE: Linked resources shared by multiple assets are planned once, with their own linked resources
+        if (!AddLinkedAssetDestination(resolver, linkDstPath, linkSrcPath)) continue;
+
+        const char *dstFilePath = BuildPath(assetsRoot, linkDstPath, NULL);
+
+        if (strchr(linkDstPath, '/') != NULL)
+        {
+            char dstDirPath[RPC_MAX_PATH_LENGTH] = { 0 };
+            strcpy(dstDirPath, dstFilePath);
+            *strrchr(dstDirPath, '/') = '\0';
+
+            AddGenDirectory(plan, dstDirPath);
+            dstFilePath = BuildPath(assetsRoot, linkDstPath, NULL);
+        }
+
+        AddGenJob(&plan->fileJobs, jobType, linkSrcPath, dstFilePath,
+            TextFormat("INFO: [linked] %s: %s\n", (jobType == GEN_JOB_COPY)? "Copying" : "Linking", dstFilePath));
+        resolver->linkedCount++;
+
+        AddGenLinkedAssets(plan, resolver, assetsRoot, linkSrcPath, linkDstPath, jobType, depth + 1);
     }
-    else if (selTemplate == 4)  // First Person 3D
+
+    resolver->files[index].resolving = false;
+}
+
+// Parse linked resources paths from asset file text, returns paths count
+// NOTE: Supported links: BMFont .fnt "page" file, glTF .gltf "uri" fields, .obj "mtllib" files, .mtl "map_*" textures,
+// paths are written to links buffer as consecutive null-terminated strings, buffer must be as big as text
+// WARNING: JSON "\uXXXX" escaped characters are not supported on .gltf uris, not expected on file paths
+static int ParseLinkedAssetPaths(const char *fileName, const char *text, char *links, int *linksSize)
+{
+    #define IS_LINE_SPACE(c) (((c) == ' ') || ((c) == '\t') || ((c) == '\r'))
+    #define IS_HEX_DIGIT(c) ((((c) >= '0') && ((c) <= '9')) || (((c) >= 'a') && ((c) <= 'f')) || (((c) >= 'A') && ((c) <= 'F')))
+
+    int count = 0;
+    int size = 0;
+
+    if (IsFileExtension(fileName, ".gltf"))
     {
-        strcpy(input->srcFilePaths[0], TextFormat("%s/src_first_person_3d/project_name.c", templatePath));
-        input->srcFileCount = 1;
+        for (const char *uri = strstr(text, "\"uri\""); uri != NULL; uri = strstr(uri, "\"uri\""))
+        {
+            uri += 5;
+            while (IS_LINE_SPACE(*uri) || (*uri == '\n')) uri++;
+            if (*uri != ':') continue;
+            uri++;
+            while (IS_LINE_SPACE(*uri) || (*uri == '\n')) uri++;
+            if (*uri != '"') continue;
+            uri++;
 
-        strcpy(input->assetFilePaths[0], TextFormat("%s/src_first_person_3d/resources/cubicmap.png", templatePath));
-        strcpy(input->assetFilePaths[1], TextFormat("%s/src_first_person_3d/resources/cubicmap_atlas.png", templatePath));
-        input->assetFileCount = 2;
+            int length = 0;
+
+            while ((*uri != '"') && (*uri != '\0'))
+            {
+                char c = *uri++;
+
+                if ((c == '\\') && (*uri != '\0')) c = *uri++;  // JSON escaped character: \/, \\, \"
+                else if ((c == '%') && IS_HEX_DIGIT(uri[0]) && IS_HEX_DIGIT(uri[1]))    // URI percent-encoded character: %20
+                {
+                    char hex[3] = { uri[0], uri[1], '\0' };
+                    c = (char)strtol(hex, NULL, 16);
+                    uri += 2;
+                }
+
+                links[size + length] = c;
+                length++;
+            }
+
+            if (length > 0)
+            {
+                links[size + length] = '\0';
+                size += (length + 1);
+                count++;
+            }
+        }
     }
-    else if (selTemplate == 5)  // raygui Tool
+    else
     {
-        strcpy(input->srcFilePaths[0], TextFormat("%s/src_raygui_tool/project_name.c", templatePath));
-        strcpy(input->srcFilePaths[1], TextFormat("%s/src_raygui_tool/raygui.h", templatePath));
-        strcpy(input->srcFilePaths[2], TextFormat("%s/src_raygui_tool/style_cyber.h", templatePath));
-        strcpy(input->srcFilePaths[3], TextFormat("%s/src_raygui_tool/style_lavanda.h", templatePath));
-        strcpy(input->srcFilePaths[4], TextFormat("%s/src_raygui_tool/style_genesis.h", templatePath));
-        strcpy(input->srcFilePaths[5], TextFormat("%s/src_raygui_tool/style_terminal.h", templatePath));
-        input->srcFileCount = 6;
+        bool fnt = IsFileExtension(fileName, ".fnt");
+        bool obj = IsFileExtension(fileName, ".obj");
 
-        // No assets required
-    }
-}
+        for (const char *line = text; *line != '\0'; )
+        {
+            const char *lineEnd = strchr(line, '\n');
+            if (lineEnd == NULL) lineEnd = line + strlen(line);
 
-// Scan asset paths from a source code file (raylib)
-// WARNING: Supported asset file extensions are hardcoded by used file types
-// but new examples could require other file extensions to be added
-static char **LoadSourceAssetPaths(const char *srcFilePath, int *assetCount)
-{
-    #define RPC_MAX_ASSET_FILES     256
-    #define RPC_ASSET_PATH_LENGTH   256
+            while ((line < lineEnd) && IS_LINE_SPACE(*line)) line++;
 
-    char **paths = (char **)RL_CALLOC(RPC_MAX_ASSET_FILES, sizeof(char **));
-    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) paths[i] = (char *)RL_CALLOC(RPC_ASSET_PATH_LENGTH, sizeof(char));
+            // Get line keyword
+            const char *keyword = line;
+            while ((line < lineEnd) && !IS_LINE_SPACE(*line)) line++;
+            int keywordLength = (int)(line - keyword);
 
-    int assetCounter = 0;
-    char *code = LoadFileText(srcFilePath);
-
-    if (code != NULL)
-    {
-        // Resources extensions to check
-        const char *exts[] = { ".png", ".bmp", ".jpg", ".qoi", ".gif", ".raw", ".hdr", ".ttf", ".fnt", ".wav", ".ogg", ".mp3", ".flac", ".mod", ".xm", ".qoa", ".obj", ".iqm", ".glb", ".m3d", ".vox", ".vs", ".fs", ".txt" };
-        const int extCount = sizeof(exts)/sizeof(char *);
-
-        char *ptr = code;
-        while ((ptr = strchr(ptr, '"')) != NULL)
-        {
-            char *start = ptr + 1;
-            char *end = strchr(start, '"');
-            if (!end) break;
-
-            // WARNING: Some paths could be for saving files, not loading, those "resource" files must be omitted
-            // TODO: HACK: Just check previous position from pointer for function name including the string and the index "distance"
-            // This is a quick solution, the good one would be getting the data loading function names...
-            int functionIndex01 = TextFindIndex(ptr - 40, "ExportImage");       // Check ExportImage()
-            int functionIndex02 = TextFindIndex(ptr - 10, "TraceLog");          // Check TraceLog()
-            int functionIndex03 = TextFindIndex(ptr - 40, "TakeScreenshot");    // Check TakeScreenshot()
-            int functionIndex04 = TextFindIndex(ptr - 40, "SaveFileData");      // Check SaveFileData()
-            int functionIndex05 = TextFindIndex(ptr - 40, "SaveFileText");      // Check SaveFileText()
-
-            if (!((functionIndex01 != -1) && (functionIndex01 < 40)) &&  // Not found ExportImage() before ""
-                !((functionIndex02 != -1) && (functionIndex02 < 10)) &&  // Not found TraceLog() before ""
-                !((functionIndex03 != -1) && (functionIndex03 < 40)) &&  // Not found TakeScreenshot() before ""
-                !((functionIndex04 != -1) && (functionIndex04 < 40)) &&  // Not found TakeScreenshot() before ""
-                !((functionIndex05 != -1) && (functionIndex05 < 40)))    // Not found SaveFileText() before ""
-            {
-                int len = (int)(end - start);
-                if ((len > 0) && (len < RPC_ASSET_PATH_LENGTH))
+            if (fnt && (keywordLength == 4) && (strncmp(keyword, "page", 4) == 0))
+            {
+                // BMFont: page id=0 file="font.png"
+                for (; line < (lineEnd - 5); line++)
                 {
-                    char buffer[RPC_ASSET_PATH_LENGTH] = { 0 };
-                    strncpy(buffer, start, len);
-                    buffer[len] = '\0';
+                    if (strncmp(line, "file=", 5) != 0) continue;
 
-                    // Check for known extensions
-                    for (int i = 0; i < extCount; i++)
+                    const char *start = line + 5;
+                    bool quoted = (*start == '"');
+                    if (quoted) start++;
+
+                    const char *end = start;
+                    while ((end < lineEnd) && ((quoted && (*end != '"')) || (!quoted && !IS_LINE_SPACE(*end)))) end++;
+
+                    if (end > start)
                     {
-                        // NOTE: IsFileExtension() expects a NULL terminated fileName string,
-                        // it looks for the last '.' and checks "extension" after that
-                        if (IsFileExtension(buffer, exts[i]))
-                        {
-                            // Avoid duplicates
-                            bool found = false;
-                            for (int j = 0; j < assetCounter; j++)
-                            {
-                                if (strcmp(paths[j], buffer) == 0) { found = true; break; }
-                            }
+                        memcpy(links + size, start, end - start);
+                        size += (int)(end - start);
+                        links[size++] = '\0';
+                        count++;
+                    }
+                    break;
+                }
+            }
+            else if (obj && (keywordLength == 6) && (strncmp(keyword, "mtllib", 6) == 0))
+            {
+                // OBJ: mtllib file01.mtl file02.mtl
+                while (line < lineEnd)
+                {
+                    while ((line < lineEnd) && IS_LINE_SPACE(*line)) line++;
 
-                            if (!found && (assetCounter < RPC_MAX_ASSET_FILES))
-                            {
-                                // TODO: WARNING: The path obtained could be relative to srcFilePath or
-                                // relative to expected build output, it must be copied to expected build output path
-                                // So, asset src path could require compute and validation
-                                strcpy(paths[assetCounter], buffer);
-                                assetCounter++;
-                            }
+                    const char *start = line;
+                    while ((line < lineEnd) && !IS_LINE_SPACE(*line)) line++;
 
-                            break;
-                        }
+                    if (line > start)
+                    {
+                        memcpy(links + size, start, line - start);
+                        size += (int)(line - start);
+                        links[size++] = '\0';
+                        count++;
                     }
                 }
             }
+            else if (!fnt && !obj && (((keywordLength > 4) && (strncmp(keyword, "map_", 4) == 0)) ||
+                     ((keywordLength == 4) && ((strncmp(keyword, "bump", 4) == 0) || (strncmp(keyword, "disp", 4) == 0) || (strncmp(keyword, "refl", 4) == 0))) ||
+                     ((keywordLength == 5) && (strncmp(keyword, "decal", 5) == 0))))
+            {
+                // MTL: map_Kd [-options values] texture.png, texture file is the last token
+                const char *end = lineEnd;
+                while ((end > line) && IS_LINE_SPACE(end[-1])) end--;
 
-            ptr = end + 1;
-        }
+                const char *start = end;
+                while ((start > line) && !IS_LINE_SPACE(start[-1])) start--;
+
+                if (end > start)
+                {
+                    memcpy(links + size, start, end - start);
+                    size += (int)(end - start);
+                    links[size++] = '\0';
+                    count++;
+                }
+            }
 
-        UnloadFileText(code);
+            line = (*lineEnd == '\n')? (lineEnd + 1) : lineEnd;
+        }
     }
 
-    /*
-    // WARNING: Some resources could require linked resources: .fnt --> .png, .mtl --> .png, .gltf --> .png
-    // So doing a recursive pass to scan possible files with second resources
-    for (int i = 0; i < assetCounter; i++)
+    *linksSize = size;
+
+    return count;
+}
+
+// Get linked resource path from linking file path, link relative to linking file directory
+// NOTE: Path separators converted to '/', '.' and '..' components resolved (leading '..' kept if not resolved)
+static bool GetLinkedAssetPath(char *result, const char *filePath, const char *link)
+{
+    const char *fileName = GetFileName(filePath);
+    int dirLength = (int)(fileName - filePath);
+    int linkLength = (int)strlen(link);
+
+    if ((dirLength + linkLength) >= RPC_MAX_PATH_LENGTH) return false;
+
+    char path[RPC_MAX_PATH_LENGTH] = { 0 };
+    memcpy(path, filePath, dirLength);
+    memcpy(path + dirLength, link, linkLength);
+
+    int length = 0;
+    int fixedLength = 0;    // Path length that can not be removed by '..' components
+
+    if ((path[0] == '/') || (path[0] == '\\')) result[length++] = '/';
+    fixedLength = length;
+
+    for (int i = 0; path[i] != '\0'; )
     {
-        if (IsFileExtension(paths[i], ".fnt;.gltf"))
-        {
-            int assetCount2 = 0;
-            // ERROR: TextFormat() is messing paths due to static buffers
-            char **assetPaths2 = LoadSourceAssetPaths(paths[i], &assetCount2);
+        while ((path[i] == '/') || (path[i] == '\\')) i++;
 
-            for (int j = 0; j < assetCount2; j++)
-            {
-                strcpy(paths[assetCounter], TextFormat("%s/%s", GetDirectoryPath(paths[i]) + 2, assetPaths2[j]));
-                assetCounter++;
-            }
+        int start = i;
+        while ((path[i] != '\0') && (path[i] != '/') && (path[i] != '\\')) i++;
+        int componentLength = i - start;
+
+        if ((componentLength == 0) || ((componentLength == 1) && (path[start] == '.'))) continue;
 
-            UnloadSourceAssetPaths(assetPaths2);
+        if ((componentLength == 2) && (path[start] == '.') && (path[start + 1] == '.') && (length > fixedLength))
+        {
+            // Remove last path component
+            while ((length > fixedLength) && (result[length - 1] != '/')) length--;
+            if (length > fixedLength) length--;
+            continue;
         }
+
+        if ((length > 0) && (result[length - 1] != '/')) result[length++] = '/';
+        memcpy(result + length, path + start, componentLength);
+        length += componentLength;
+
+        // NOTE: Unresolved '..' components can not be removed
+        if ((componentLength == 2) && (path[start] == '.') && (path[start + 1] == '.')) fixedLength = length;
     }
-    */
 
-    *assetCount = assetCounter;
-    return paths;
+    result[length] = '\0';
+
+    return (length > 0);
 }
 
-// Clear resource paths scanned
-static void UnloadSourceAssetPaths(char **assetPaths)
+// Get path lookup table slot, slot contains path index or -1 if path not found (slot to be used)
+// NOTE: Lookup table slots indexed by path hash (FNV-1a 64bit), linear probing, size must be power of two
+static int *GetPathLookupSlot(int *lookup, int lookupSize, char **paths, const char *path)
 {
-    for (int i = 0; i < RPC_MAX_ASSET_FILES; i++) RL_FREE(assetPaths[i]);
+    unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)path, (int)strlen(path)) & (lookupSize - 1);
 
-    RL_FREE(assetPaths);
+    while ((lookup[slot] >= 0) && (strcmp(paths[lookup[slot]], path) != 0)) slot = (slot + 1) & (lookupSize - 1);
+
+    return &lookup[slot];
 }
 
-// Generate tool project files
-// Project input files required to update:
-//  - src/project_name.c
-//  - src/project_name.rc
-//  - src/project_name.ico
-//  - src/project_name.icns
-//  - src/Info.plist
-//  - src/minshell.html
-//  - src/Makefile
-//  - projects/scripts/*
-//  - projects/VS2022/*
-//  - projects/VSCode/*
-//  - README.md
-//  - LICENSE
-static void GenerateProject(rpcProjectConfig project, rpcProjectInput input, const char *outPath)
+// Profiling functions
+//------------------------------------------------------------------------------------
+// Initialize profiler, events recording enabled
+static void InitProfiler(void)
 {
-    char *fileText = NULL;
-    char *fileTextUpdated[10] = { 0 };
+    memset(&profiler, 0, sizeof(Profiler));
 
-    // Get template directory
-    // TODO: Use embedded template into executable?
-    char templatePath[256] = { 0 };
+    profiler.baseTime = GetProfileTime();
+    profiler.enabled = true;
+}
 
-    // NOTE: [template] directory must be in same directory as [rpc] tool
-    strcpy(templatePath, TextFormat("%s/template", GetWorkingDirectory()));
-    //strcpy(templatePath, TextFormat("%s/template", GetApplicationDirectory()));
+// Close profiler, saving recorded events as Chrome trace_event JSON
+// NOTE: Trace can be opened with chrome://tracing or https://ui.perfetto.dev
+static void CloseProfiler(const char *fileName)
+{
+    if (!profiler.enabled) return;
 
-    // Security check to validate required template
-    if (!DirectoryExists(templatePath) ||
-        !DirectoryExists(TextFormat("%s/src", templatePath)) ||
-        !DirectoryExists(TextFormat("%s/projects", templatePath)) ||
-        !FileExists(TextFormat("%s/project_name.rpc", templatePath)))
+    FILE *file = fopen(fileName, "wt");
+
+    if (file != NULL)
     {
-        LOG("WARNING: Project generation template required files can not be found\n");
-        return;
+        fprintf(file, "{\n\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [\n");
+
+        // Threads names metadata events
+        fprintf(file, "{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, \"args\": { \"name\": \"Main thread\" } },\n");
+        fprintf(file, "{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %i, \"args\": { \"name\": \"Generation sections\" } }", RPC_MAX_WORKER_THREADS + 1);
+
+        for (int i = 0; i < profiler.count; i++)
+        {
+            const ProfileEvent *event = &profiler.events[i];
+
+            fprintf(file, ",\n{ \"name\": ");
+            SaveJSONText(file, event->name);
+            fprintf(file, ", \"cat\": ");
+            SaveJSONText(file, event->category);
+            fprintf(file, ", \"ph\": \"X\", \"pid\": 1, \"tid\": %i, \"ts\": %.3f, \"dur\": %.3f, \"args\": { \"bytesRead\": %lld, \"bytesWritten\": %lld } }",
+                event->threadId, event->startTime, event->duration, event->bytesRead, event->bytesWritten);
+        }
+
+        fprintf(file, "\n]\n}\n");
+        fclose(file);
+
+        LOG("INFO: Profile trace saved: %s (%i events)\n", fileName, profiler.count);
     }
+    else LOG("WARNING: Profile trace could not be saved: %s\n", fileName);
 
-    // Update raylib src path, OS-dependant:
-    // - Windows: raylib Windows Installer default: C:/raylib/raylib
-    // - Linux: Usually installed in system and widely available
-    // - macOS: Dependant on user placement, default to: $(HOME)/Library/raylib
-    char raylibSrcPath[256] = { 0 };
-#if defined(__linux__)
-    strcpy(raylibSrcPath, ".");
-#elif defined(__FreeBSD__)
-    strcpy(raylibSrcPath, ".");
-#elif defined(__APPLE__)
-    strcpy(raylibSrcPath, "$(HOME)/Library/raylib");
+    RL_FREE(profiler.events);
+    memset(&profiler, 0, sizeof(Profiler));
+}
+
+// Get time since profiler initialization (microseconds)
+// NOTE: Monotonic clock, thread-safe, it does not require raylib window initialization (GetTime())
+static double GetProfileTime(void)
+{
+    double time = 0.0;
+
+#if defined(PLATFORM_WEB)
+    time = emscripten_get_now()*1000.0;
+#elif defined(_WIN32)
+    long long counter = 0;
+    long long frequency = 1;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    time = (double)counter*1000000.0/(double)frequency;
 #else
-    strcpy(raylibSrcPath, rpcGetText(project, "RAYLIB_SRC_PATH"));
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    time = (double)now.tv_sec*1000000.0 + (double)now.tv_nsec/1000.0;
 #endif
 
-    LOG("INFO: Starting project generation: %s\n", rpcGetText(project, "PROJECT_REPO_NAME")? rpcGetText(project, "PROJECT_REPO_NAME") : "-");
+    return time - profiler.baseTime;
+}
 
-    //mz_bool mz_zip_reader_init_mem(mz_zip_archive *pZip, const void *pMem, size_t size, mz_uint flags); // Read file from memory zip data
-    // TODO: Replace LoadFileText(), from template path, by reading text file from zip data, decompressing it...
+// Begin profile event on main thread, returns event index (-1 if profiler disabled)
+static int BeginProfileEvent(const char *name, const char *category)
+{
+    if (!profiler.enabled) return -1;
 
-    if (rpcGetText(project, "PROJECT_REPO_NAME")[0] == '\0') strcpy(rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME"));
+    double time = GetProfileTime();
+    AddProfileEvent(name, category, 0, time, time, 0, 0);
 
-    LOG("INFO: Output path: %s/%s\n\n", outPath, rpcGetText(project, "PROJECT_REPO_NAME"));
+    return profiler.count - 1;
+}
 
-    LOG("INFO: Output project source code path: %s/%s", rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH"));
-    LOG("INFO: Input source code files to be added [%i]:\n", input.srcFileCount);
-    for (int i = 0; i < input.srcFileCount; i++) LOG("      [%i/%i] %s\n", i + 1, input.srcFileCount, input.srcFilePaths[i]);
-    LOG("\n");
-    LOG("INFO: Output project assets path: %s/%s", rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_ASSETS_PATH"));
-    LOG("INFO: Input asset files to be added [%i]:\n", input.assetFileCount);
-    for (int i = 0; i < input.assetFileCount; i++) LOG("      [%i/%i] %s\n", i + 1, input.assetFileCount, input.assetFilePaths[i]);
-    LOG("\n");
+// End profile event, registering bytes read/written
+static void EndProfileEvent(int index, long long bytesRead, long long bytesWritten)
+{
+    if (!profiler.enabled || (index < 0) || (index >= profiler.count)) return;
 
-    // Copy project source file(s) provided
-    //--------------------------------------------------------------------------
-    LOG("INFO: Copying input source files to project sources path: %s/%s\n",
-        rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH"));
+    ProfileEvent *event = &profiler.events[index];
+    event->duration = GetProfileTime() - event->startTime;
+    event->bytesRead = bytesRead;
+    event->bytesWritten = bytesWritten;
+}
 
-    // Create required output directories (src/external)
-    MakeDirectory(TextFormat("%s/%s/%s/external", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH")));
+// Add complete profile event
+// WARNING: Events must be added from main thread
+static void AddProfileEvent(const char *name, const char *category, int threadId, double startTime, double endTime, long long bytesRead, long long bytesWritten)
+{
+    if (!profiler.enabled) return;
 
-    for (int i = 0; i < input.srcFileCount; i++)
+    if (profiler.count >= profiler.capacity)
     {
-        // Get expected destination file path for source input files
-        const char *dstFilePath = TextFormat("%s/%s/%s/%s", outPath, rpcGetText(project, "PROJECT_REPO_NAME"),
-            rpcGetText(project, "PROJECT_SOURCE_PATH"), GetFileName(input.srcFilePaths[i]));
+        profiler.capacity = (profiler.capacity > 0)? profiler.capacity*2 : 256;
+        profiler.events = (ProfileEvent *)RL_REALLOC(profiler.events, profiler.capacity*sizeof(ProfileEvent));
+    }
 
-        // NOTE: In case file name contains "project_name", replacing it by user defined project internal name
-        FileCopy(input.srcFilePaths[i], TextReplace(dstFilePath, "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME")));
+    ProfileEvent *event = &profiler.events[profiler.count];
+    memset(event, 0, sizeof(ProfileEvent));
+
+    strncpy(event->name, name, 127);
+    event->category = category;
+    event->threadId = threadId;
+    event->startTime = startTime;
+    event->duration = endTime - startTime;
+    event->bytesRead = bytesRead;
+    event->bytesWritten = bytesWritten;
 
-        LOG("INFO: [%i/%i] Copying: %s\n", i + 1, input.srcFileCount, TextReplace(dstFilePath, "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME")));
+    profiler.count++;
+}
+
+// Project generation manifest functions
+//------------------------------------------------------------------------------------
+// Compute data hash (FNV-1a 64bit)
+static unsigned long long ComputeHashFNV64(const unsigned char *data, int dataSize)
+{
+    return UpdateHashFNV64(0xcbf29ce484222325ULL, data, dataSize);
+}
+
+// Update data hash (FNV-1a 64bit), useful to compute hash by chunks
+static unsigned long long UpdateHashFNV64(unsigned long long hash, const unsigned char *data, int dataSize)
+{
+    for (int i = 0; i < dataSize; i++)
+    {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
     }
 
-    LOG("INFO: Copied project source files successfully\n");
-    //-------------------------------------------------------------------------------------
+    return hash;
+}
 
-    // Copy assets to output resource path (if required)
-    //-------------------------------------------------------------------------------------
-    if (input.assetFileCount > 0)
+// Compute file data hash (FNV-1a 64bit), file data read by chunks
+// NOTE: Memory required does not depend on file size, returns 0 if file could not be read
+static unsigned long long ComputeFileHashFNV64(const char *fileName)
+{
+    unsigned long long hash = 0;
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
     {
-        LOG("INFO: Copying input assets files to project resources path: %s/%s\n", rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_ASSETS_PATH"));
+        unsigned char *buffer = (unsigned char *)RL_MALLOC(RPC_COPY_CHUNK_SIZE);
+        size_t readCount = 0;
 
-        MakeDirectory(TextFormat("%s/%s/%s", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_ASSETS_PATH")));
+        hash = 0xcbf29ce484222325ULL;
+        while ((readCount = fread(buffer, 1, RPC_COPY_CHUNK_SIZE, file)) > 0) hash = UpdateHashFNV64(hash, buffer, (int)readCount);
+        if (ferror(file)) hash = 0;
 
-        for (int i = 0; i < input.assetFileCount; i++)
-        {
-            // Get expected destination file path
-            const char *dstFilePath = TextFormat("%s/%s/%s/%s", outPath, rpcGetText(project, "PROJECT_REPO_NAME"),
-                rpcGetText(project, "PROJECT_ASSETS_PATH"), GetFileName(input.assetFilePaths[i]));
-            FileCopy(input.assetFilePaths[i], dstFilePath); // Copy always with original name
+        RL_FREE(buffer);
+        fclose(file);
+    }
 
-            LOG("INFO: [%i/%i] Copying: %s\n", i + 1, input.assetFileCount, dstFilePath);
-        }
+    return hash;
+}
+
+// Copy file data, trying kernel-side copies first
+//  - Windows: CopyFileA(), block cloning supported by ReFS
+//  - Linux: Reflink clone (FICLONE: btrfs, xfs...), copy_file_range(), sendfile()
+//  - macOS: copyfile() clone (APFS) or kernel copy
+// NOTE: Fallback copy uses a fixed size buffer, memory required does not depend on file size,
+// data hash is computed on fallback copy as data passes through user memory, source file is read again
+// to compute it on kernel-side copies (data is usually still in file system cache)
+static bool CopyFileData(const char *srcPath, const char *dstPath, unsigned long long *hash)
+{
+    if (hash != NULL) *hash = 0;
+
+    // WARNING: Destination opened for writing would truncate source file data if both are the same file,
+    // file data is already at destination, nothing to copy
+    bool copied = IsSameFile(srcPath, dstPath);
 
-        LOG("INFO: Copied project asset files successfully\n");
+#if !defined(PLATFORM_WEB)
+#if defined(_WIN32)
+    if (!copied) copied = (CopyFileA(srcPath, dstPath, 0) != 0);
+#elif defined(__APPLE__)
+    // NOTE: Clone requires destination not existing
+    if (!copied)
+    {
+        remove(dstPath);
+        copied = (copyfile(srcPath, dstPath, NULL, COPYFILE_CLONE) == 0);
     }
-    //-------------------------------------------------------------------------------------
+#elif defined(__linux__)
+    int srcDesc = copied? -1 : open(srcPath, O_RDONLY);
 
-    // Project configuration file (.rpc)
-    // NOTE: This file can be used by [rpb] to build the project
-    //-------------------------------------------------------------------------------------
-    LOG("INFO: Generating project config file (.rpc): %s/%s.rpc\n", rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-    // Update project configuration .rpc to defined values by [rpc] tool
-    rini_data data = rini_load_full(TextFormat("%s/project_name.rpc", templatePath));
-    rini_set_value_text(&data, "PROJECT_REPO_NAME", rpcGetText(project, "PROJECT_REPO_NAME"), NULL);
-    rini_set_value_text(&data, "PROJECT_INTERNAL_NAME", rpcGetText(project, "PROJECT_INTERNAL_NAME"), NULL);
-    rini_set_value_text(&data, "PROJECT_COMMERCIAL_NAME", rpcGetText(project, "PROJECT_COMMERCIAL_NAME"), NULL);
-    rini_set_value_text(&data, "PROJECT_SHORT_NAME", rpcGetText(project, "PROJECT_SHORT_NAME"), NULL);
-    rini_set_value_text(&data, "PROJECT_VERSION", rpcGetText(project, "PROJECT_VERSION"), NULL);
-    rini_set_value_text(&data, "PROJECT_DESCRIPTION", rpcGetText(project, "PROJECT_DESCRIPTION"), NULL);
-    rini_set_value_text(&data, "PROJECT_PUBLISHER_NAME", rpcGetText(project, "PROJECT_PUBLISHER_NAME"), NULL);
-    rini_set_value_text(&data, "PROJECT_DEVELOPER_NAME", rpcGetText(project, "PROJECT_DEVELOPER_NAME"), NULL);
-    rini_set_value_text(&data, "PROJECT_DEVELOPER_URL", rpcGetText(project, "PROJECT_DEVELOPER_URL"), NULL);
-    rini_set_value_text(&data, "PROJECT_DEVELOPER_EMAIL", rpcGetText(project, "PROJECT_DEVELOPER_EMAIL"), NULL);
-    rini_set_value_text(&data, "PROJECT_ICON_FILE", rpcGetText(project, "PROJECT_ICON_FILE"), NULL);
-    rini_save(data, TextFormat("%s/%s/%s.rpc", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME")));
-
-    LOG("INFO: Project config file (.rpc) generated successfully\n");
-    //-------------------------------------------------------------------------------------
+    if (srcDesc >= 0)
+    {
+        struct stat srcStat = { 0 };
+        int dstDesc = open(dstPath, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+        if ((dstDesc >= 0) && (fstat(srcDesc, &srcStat) == 0))
+        {
+            // Try reflink clone, sharing data blocks between files (copy-on-write file systems)
+            if (ioctl(dstDesc, FICLONE, srcDesc) == 0) copied = true;
+
+        #if defined(SYS_copy_file_range)
+            // Try kernel copy between files, it could also use server-side copy or reflink
+            if (!copied)
+            {
+                long long srcOffset = 0;
+                long long dstOffset = 0;
+
+                while (srcOffset < srcStat.st_size)
+                {
+                    long result = syscall(SYS_copy_file_range, srcDesc, &srcOffset, dstDesc, &dstOffset, (size_t)(srcStat.st_size - srcOffset), 0);
+                    if (result <= 0) break;
+                }
 
-    // Project build system: Scripts
-    //-------------------------------------------------------------------------------------
-    if (input.requestedBuildSystems[0])
-    {
-        LOG("INFO: Generating build system: scripts (.bat, .sh)\n");
+                copied = (srcOffset == srcStat.st_size);
 
-        // Create required output directories
-        MakeDirectory(TextFormat("%s/%s/projects/scripts", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
+                // Reset destination file on failure, copy restarted by next method
+                if (!copied && (ftruncate(dstDesc, 0) != 0)) srcStat.st_size = -1;
+            }
+        #endif
+            // Try kernel copy through sendfile() (Linux >= 2.6.33 supports regular files output)
+            if (!copied && (srcStat.st_size >= 0))
+            {
+                off_t srcOffset = 0;
+                lseek(dstDesc, 0, SEEK_SET);
 
-        // Update src/build.bat (Windows only)
-        // TODO: Use CMD/Shell calls directly, current script uses Makefile
-        fileText = LoadFileText(TextFormat("%s/projects/scripts/build.bat", templatePath));
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-        fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION"));
-        fileTextUpdated[2] = TextReplaceAlloc(fileTextUpdated[1], "C:\\raylib\\w64devkit\\bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH"));
-        SaveFileText(TextFormat("%s/%s/projects/scripts/build.bat", outPath, rpcGetText(project, "PROJECT_REPO_NAME")), fileTextUpdated[2]);
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+                while (srcOffset < srcStat.st_size)
+                {
+                    ssize_t result = sendfile(dstDesc, srcDesc, &srcOffset, (size_t)(srcStat.st_size - srcOffset));
+                    if (result <= 0) break;
+                }
 
-        // TODO: Add .sh build script
+                copied = (srcOffset == srcStat.st_size);
+            }
+        }
 
-        LOG("INFO: Build system generated successfully: scripts (.bat, .sh)\n");
+        if (dstDesc >= 0) close(dstDesc);
+        close(srcDesc);
     }
-    //-------------------------------------------------------------------------------------
+#endif
+#endif // !PLATFORM_WEB
 
-    // Project build system: Makefile
-    //-------------------------------------------------------------------------------------
-    if (input.requestedBuildSystems[1])
+    if (copied)
     {
-        LOG("INFO: Generating build system: Makefile\n");
+        if (hash != NULL) *hash = ComputeFileHashFNV64(srcPath);
+        return true;
+    }
 
-        // Update src/Makefile
-        fileText = LoadFileText(TextFormat("%s/src/Makefile", templatePath));
+    // Fallback: Chunked copy through a fixed size buffer
+    bool result = false;
+    FILE *srcFile = fopen(srcPath, "rb");
 
-        // Get names for the input source paths (only filename, without path)
-        char **srcFileNames = (char **)RL_CALLOC(RPC_MAX_SOURCE_FILES, sizeof(char *));
-        for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) srcFileNames[i] = (char *)RL_CALLOC(RPC_SOURCE_PATH_LENGTH, sizeof(char));
+    if (srcFile != NULL)
+    {
+        FILE *dstFile = fopen(dstPath, "wb");
 
-        int srcFileCount = 0;
-        for (int j = 0; j < input.srcFileCount; j++)
+        if (dstFile != NULL)
         {
-            if (IsFileExtension(input.srcFilePaths[j], ".c"))
+            unsigned char *buffer = (unsigned char *)RL_MALLOC(RPC_COPY_CHUNK_SIZE);
+            unsigned long long dataHash = 0xcbf29ce484222325ULL;
+            size_t readCount = 0;
+
+            result = true;
+
+            while ((readCount = fread(buffer, 1, RPC_COPY_CHUNK_SIZE, srcFile)) > 0)
             {
-                // TODO: WARNING: Some code files could be inside a directory structure,
-                // but on copy it will be eliminated
-                strcpy(srcFileNames[srcFileCount], GetFileName(input.srcFilePaths[j]));
-                srcFileCount++;
+                dataHash = UpdateHashFNV64(dataHash, buffer, (int)readCount);
+                if (fwrite(buffer, 1, readCount, dstFile) != readCount) { result = false; break; }
             }
-        }
 
-        // Add all project required sources concatenated
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "project_name.c", TextJoin(srcFileNames, srcFileCount, " "));
-        fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-        fileTextUpdated[2] = TextReplaceAlloc(fileTextUpdated[1], "C:\\raylib\\w64devkit\\bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH"));
-        fileTextUpdated[3] = TextReplaceAlloc(fileTextUpdated[2], "C:/raylib/raylib/src", raylibSrcPath);
-        if (input.assetFileCount > 0)
-        {
-            // If project includes resources, update Makefile required lines
-            fileTextUpdated[4] = TextReplaceAlloc(fileTextUpdated[3], "BUILD_WEB_RESOURCES   ?= FALSE", "BUILD_WEB_RESOURCES   ?= TRUE");
-            // TODO: Update also resources path for building?: "BUILD_WEB_RESOURCES_PATH ?= resources"
-            SaveFileText(TextFormat("%s/%s/%s/Makefile", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH")), fileTextUpdated[4]);
+            if (ferror(srcFile)) result = false;
+            if (result && (hash != NULL)) *hash = dataHash;
+
+            RL_FREE(buffer);
+            fclose(dstFile);
         }
-        else SaveFileText(TextFormat("%s/%s/%s/Makefile", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH")), fileTextUpdated[3]);
 
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+        fclose(srcFile);
+    }
+
+    return result;
+}
 
-        for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) RL_FREE(srcFileNames[i]);
-        RL_FREE(srcFileNames);
+// Link destination file to source file, no file data is copied
+//  - Hardlink: Destination shares source file data, it requires same file system (volume),
+//    symlink is created instead if crossing file systems
+//  - Symlink: Destination points to source file absolute path
+// NOTE: Existing destination file is replaced, Windows unprivileged symlinks require Developer Mode
+static bool LinkFileData(const char *srcPath, const char *dstPath, bool symbolic)
+{
+    bool result = false;
 
-        // Add Makefile.Android for Android APK building target
-        FileCopy(TextFormat("%s/src/Makefile.Android", templatePath),
-            TextFormat("%s/%s/%s/Makefile.Android", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH")));
+#if !defined(PLATFORM_WEB)
+    remove(dstPath);
 
-        LOG("INFO: Build system generated successfully: Makefile\n");
+#if defined(_WIN32)
+    if (!symbolic)
+    {
+        result = CreateHardLinkA(dstPath, srcPath, NULL);
+        if (!result && (GetLastError() == 17)) symbolic = true;     // ERROR_NOT_SAME_DEVICE
     }
-    //-------------------------------------------------------------------------------------
 
-    // Project build system: VSCode
-    //-------------------------------------------------------------------------------------
-    if (input.requestedBuildSystems[2])
+    if (symbolic)
+    {
+        char fullPath[RPC_MAX_PATH_LENGTH] = { 0 };
+        if (GetFullPathNameA(srcPath, RPC_MAX_PATH_LENGTH, fullPath, NULL) > 0) result = (CreateSymbolicLinkA(dstPath, fullPath, 0x2) != 0); // SYMBOLIC_LINK_FLAG_ALLOW_UNPRIVILEGED_CREATE
+    }
+#else
+    if (!symbolic)
     {
-        LOG("INFO: Generating build system: VSCode\n");
+        result = (link(srcPath, dstPath) == 0);
+        if (!result && (errno == EXDEV)) symbolic = true;
+    }
 
-        // Create required output directories
-        MakeDirectory(TextFormat("%s/%s/projects/VSCode/.vscode", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
+    if (symbolic)
+    {
+        char *fullPath = realpath(srcPath, NULL);
 
-        // Update projects/VSCode/.vscode/launch.json
-        fileText = LoadFileText(TextFormat("%s/projects/VSCode/.vscode/launch.json", templatePath));
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-        fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "C:\\raylib\\w64devkit\\bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH"));
-        SaveFileText(TextFormat("%s/%s/projects/VSCode/.vscode/launch.json", outPath, rpcGetText(project, "PROJECT_REPO_NAME")), fileTextUpdated[1]);
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+        if (fullPath != NULL) result = (symlink(fullPath, dstPath) == 0);
+        free(fullPath);     // NOTE: Path allocated by realpath() using malloc()
+    }
+#endif
+#endif // !PLATFORM_WEB
 
-        // Update projects/VSCode/.vscode/c_cpp_properties.json
-        fileText = LoadFileText(TextFormat("%s/projects/VSCode/.vscode/c_cpp_properties.json", templatePath));
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "C:/raylib/raylib/src", raylibSrcPath);
-        fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "C:/raylib/w64devkit/bin", rpcGetText(project, "PLATFORM_WINDOWS_W64DEVKIT_PATH"));
-        SaveFileText(TextFormat("%s/%s/projects/VSCode/.vscode/c_cpp_properties.json", outPath, rpcGetText(project, "PROJECT_REPO_NAME")), fileTextUpdated[1]);
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+    return result;
+}
 
-        // Update projects/VSCode/.vscode/tasks.json
-        fileText = LoadFileText(TextFormat("%s/projects/VSCode/.vscode/tasks.json", templatePath));
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "C:/raylib/raylib/src", raylibSrcPath);
-        SaveFileText(TextFormat("%s/%s/projects/VSCode/.vscode/tasks.json", outPath, rpcGetText(project, "PROJECT_REPO_NAME")), fileTextUpdated[0]);
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+// Check if destination file is a link to source file
+// NOTE: Symlink check requires destination to be a symbolic link, hardlink check requires it not to be one,
+// destination path being source file path is not a link, on Windows links are not checked and they are always created again
+static bool IsFileLinked(const char *srcPath, const char *dstPath, bool symbolic)
+{
+    bool result = false;
 
-        // Copy projects/VSCode/.vscode/settings.json
-        FileCopy(TextFormat("%s/projects/VSCode/.vscode/settings.json", templatePath),
-            TextFormat("%s/%s/projects/VSCode/.vscode/settings.json", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
+#if !defined(PLATFORM_WEB) && !defined(_WIN32)
+    struct stat srcStat = { 0 };
+    struct stat dstStat = { 0 };
+    struct stat linkStat = { 0 };
 
-        // Copy projects/VSCode/main.code-workspace
-        FileCopy(TextFormat("%s/projects/VSCode/main.code-workspace", templatePath),
-            TextFormat("%s/%s/projects/VSCode/main.code-workspace", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
+    if ((stat(srcPath, &srcStat) == 0) && (stat(dstPath, &dstStat) == 0) && (lstat(dstPath, &linkStat) == 0))
+    {
+        result = ((srcStat.st_dev == dstStat.st_dev) && (srcStat.st_ino == dstStat.st_ino) && ((S_ISLNK(linkStat.st_mode) != 0) == symbolic));
+        if (result) result = !IsSameFilePath(srcPath, dstPath);
+    }
+#endif
 
-        // Copy projects/VSCode/README.md
-        FileCopy(TextFormat("%s/projects/VSCode/README.md", templatePath),
-            TextFormat("%s/%s/projects/VSCode/README.md", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
+    return result;
+}
 
-        LOG("INFO: Build system generated successfully: VSCode\n");
-    }
-    //-------------------------------------------------------------------------------------
+// Check if both paths refer to the same file data, links to a file refer to the same file data
+// NOTE: Windows links are not checked, full paths are compared instead
+static bool IsSameFile(const char *pathA, const char *pathB)
+{
+    bool result = false;
 
-    // Project build system: VS2022
-    //-------------------------------------------------------------------------------------
-    if (input.requestedBuildSystems[3])
-    {
-        LOG("INFO: Generating build system: Visual Studio 2022\n");
+#if !defined(PLATFORM_WEB) && defined(_WIN32)
+    char fullPathA[RPC_MAX_PATH_LENGTH] = { 0 };
+    char fullPathB[RPC_MAX_PATH_LENGTH] = { 0 };
 
-        // Create required output directories
-        MakeDirectory(TextFormat("%s/%s/projects/VS2022/raylib", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
-        MakeDirectory(TextFormat("%s/%s/projects/VS2022/%s", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME")));
+    if ((GetFullPathNameA(pathA, RPC_MAX_PATH_LENGTH, fullPathA, NULL) > 0) && (GetFullPathNameA(pathB, RPC_MAX_PATH_LENGTH, fullPathB, NULL) > 0))
+    {
+        // NOTE: Windows file paths are case-insensitive
+        result = true;
+        for (int i = 0; result && ((fullPathA[i] != '\0') || (fullPathB[i] != '\0')); i++)
+        {
+            char a = ((fullPathA[i] >= 'A') && (fullPathA[i] <= 'Z'))? fullPathA[i] + 32 : fullPathA[i];
+            char b = ((fullPathB[i] >= 'A') && (fullPathB[i] <= 'Z'))? fullPathB[i] + 32 : fullPathB[i];
+            result = (a == b);
+        }
+    }
+#elif !defined(PLATFORM_WEB)
+    struct stat statA = { 0 };
+    struct stat statB = { 0 };
 
-        // Copy projects/VS2022/raylib/raylib.vcxproj
-        fileText = LoadFileText(TextFormat("%s/projects/VS2022/raylib/raylib.vcxproj", templatePath));
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "C:\\raylib\\raylib\\src", raylibSrcPath);
-        SaveFileText(TextFormat("%s/%s/projects/VS2022/raylib/raylib.vcxproj", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME")), fileTextUpdated[0]);
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+    if ((stat(pathA, &statA) == 0) && (stat(pathB, &statB) == 0)) result = ((statA.st_dev == statB.st_dev) && (statA.st_ino == statB.st_ino));
+#endif
 
-        // Copy projects/VS2022/raylib/Directory.Build.props
-        //fileText = LoadFileText(TextFormat("%s/projects/VS2022/raylib/Directory.Build.props", templatePath));
-        //SaveFileText(TextFormat("%s/%s/projects/VS2022/raylib/Directory.Build.props", outPath, rpcGetText(project, "PROJECT_INTERNAL_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME")), fileText);
-        //UnloadFileText(fileText);
+    return result;
+}
 
-        // Update projects/VS2022/project_name/config->project_name.vcproj
-        fileText = LoadFileText(TextFormat("%s/projects/VS2022/project_name/project_name.vcxproj", templatePath));
+// Check if both paths refer to the same file entry, paths to linked files (hardlinks or symlinks) are different entries
+// NOTE: Parent directories are resolved to full paths and file names compared, only checked for paths of the same file data
+static bool IsSameFilePath(const char *pathA, const char *pathB)
+{
+    bool result = false;
 
-        // Get names for the input source paths (only filename, without path)
-        char **srcFileNames = (char **)RL_CALLOC(RPC_MAX_SOURCE_FILES, sizeof(char *));
-        for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) srcFileNames[i] = (char *)RL_CALLOC(RPC_SOURCE_PATH_LENGTH, sizeof(char));
+    if (IsSameFile(pathA, pathB))
+    {
+#if !defined(PLATFORM_WEB) && !defined(_WIN32)
+        const char *paths[2] = { pathA, pathB };
+        char fullPaths[2][RPC_MAX_PATH_LENGTH] = { 0 };
+        int resolvedCount = 0;
 
-        int srcFileCount = 0;
-        for (int j = 0; j < input.srcFileCount; j++)
+        for (int i = 0; i < 2; i++)
         {
-            if (IsFileExtension(input.srcFilePaths[j], ".c"))
+            char dirPath[RPC_MAX_PATH_LENGTH] = { 0 };
+            const char *fileName = strrchr(paths[i], '/');
+
+            if (fileName == NULL)
             {
-                // TODO: WARNING: Some code files could be inside a directory structure,
-                // but on copy it will be eliminated
-                strcpy(srcFileNames[srcFileCount], GetFileName(input.srcFilePaths[j]));
-                srcFileCount++;
+                dirPath[0] = '.';
+                fileName = paths[i];
             }
-        }
-
-        // Add all project required sources concatenated
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "project_name.c", srcFileNames[0]); // TODO: Main source code file
-        char srcFilesBlock[1024] = { 0 };
-        int nextPosition = 0;
-        for (int k = 1; k < srcFileCount; k++)
-        {
-            TextAppend(srcFilesBlock, TextFormat("<ClCompile Include=\"..\\..\\..\\%s\\%s\" />\n    ",
-                rpcGetText(project, "PROJECT_SOURCE_PATH"), srcFileNames[k]), &nextPosition);
-        }
-
-        fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "<!--Additional Compile Items-->", srcFilesBlock);
+            else
+            {
+                int dirLength = (int)(fileName - paths[i]);
+                if (dirLength >= RPC_MAX_PATH_LENGTH) dirLength = RPC_MAX_PATH_LENGTH - 1;
 
-        for (int i = 0; i < RPC_MAX_SOURCE_FILES; i++) RL_FREE(srcFileNames[i]);
-        RL_FREE(srcFileNames);
+                if (dirLength == 0) dirPath[0] = '/';
+                else memcpy(dirPath, paths[i], dirLength);
+                fileName++;
+            }
 
-        fileTextUpdated[2] = TextReplaceAlloc(fileTextUpdated[1], "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-        fileTextUpdated[3] = TextReplaceAlloc(fileTextUpdated[2], "C:\\raylib\\raylib\\src", raylibSrcPath);
-        SaveFileText(TextFormat("%s/%s/projects/VS2022/%s/%s.vcxproj", outPath, rpcGetText(project, "PROJECT_REPO_NAME"),
-            rpcGetText(project, "PROJECT_INTERNAL_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME")), fileTextUpdated[3]);
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+            char *fullDirPath = realpath(dirPath, NULL);
 
-        // Copy user file to set working directory to src path, so resources can be found
-        FileCopy(TextFormat("%s/projects/VS2022/project_name/project_name.vcxproj.user", templatePath),
-            TextFormat("%s/%s/projects/VS2022/%s/%s.vcxproj.user", outPath, rpcGetText(project, "PROJECT_REPO_NAME"),
-                rpcGetText(project, "PROJECT_INTERNAL_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME")));
+            if (fullDirPath != NULL)
+            {
+                snprintf(fullPaths[i], RPC_MAX_PATH_LENGTH, "%s/%s", fullDirPath, fileName);
+                resolvedCount++;
+            }
 
-        // Update projects/VS2022/project_name.sln
-        fileText = LoadFileText(TextFormat("%s/projects/VS2022/project_name.sln", templatePath));
-        fileTextUpdated[0] = TextReplaceAlloc(fileText, "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-        SaveFileText(TextFormat("%s/%s/projects/VS2022/%s.sln", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_INTERNAL_NAME")), fileTextUpdated[0]);
-        for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-        UnloadFileText(fileText);
+            free(fullDirPath);      // NOTE: Path allocated by realpath() using malloc()
+        }
 
-        LOG("INFO: Build system generated successfully: Visual Studio 2022\n");
+        result = ((resolvedCount == 2) && (strcmp(fullPaths[0], fullPaths[1]) == 0));
+#else
+        result = true;      // NOTE: Full paths already compared by IsSameFile()
+#endif
     }
-    //-------------------------------------------------------------------------------------
 
-    // Project build system: CMake
-    //-------------------------------------------------------------------------------------
-    if (input.requestedBuildSystems[4])
-    {
-        LOG("INFO: Generating build system: CMake\n");
+    return result;
+}
 
-        // Create required output directories
-        MakeDirectory(TextFormat("%s/%s/projects/CMake", outPath, rpcGetText(project, "PROJECT_INTERNAL_NAME")));
+// Load generation manifest file (.rpc-manifest)
+// NOTE: One entry per line, tab-separated fields:
+//   type  hash  srcSize  srcModTime  outSize  outModTime  outPath  srcPath
+static GenManifest LoadGenManifest(const char *fileName)
+{
+    GenManifest manifest = { 0 };
 
-        // TODO: Add CMake build system
+    char *fileText = FileExists(fileName)? LoadFileText(fileName) : NULL;
+    if (fileText == NULL) return manifest;
 
-        LOG("INFO: Build system generated successfully: CMake\n");
-    }
-    //-------------------------------------------------------------------------------------
+    int lineCount = 0;
+    for (char *ptr = fileText; *ptr != '\0'; ptr++) if (*ptr == '\n') lineCount++;
 
-    // Project build system: GitHub Actions
-    // - Windows: Uses VS2022 project
-    // - Linux, macOS, WebAssembly: Uses Makefile project
-    // WARNING: Expects the PROJECT_NAME to be the repository-name (as generated by default)
-    //-------------------------------------------------------------------------------------
-    if (input.requestedBuildSystems[5])
+    manifest.entries = (GenManifestEntry *)RL_CALLOC(lineCount + 1, sizeof(GenManifestEntry));
+
+    char *line = fileText;
+    while ((line != NULL) && (*line != '\0'))
     {
-        LOG("INFO: Generating build system: GitHub Actions (CI/CD workflows)\n");
+        char *lineEnd = strchr(line, '\n');
+        if (lineEnd != NULL) *lineEnd = '\0';
 
-        // Create required output directories
-        MakeDirectory(TextFormat("%s/%s/.github/workflows", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
+        if (line[0] != '#')
+        {
+            // Split line fields by tabs
+            char *fields[8] = { 0 };
+            int fieldCount = 0;
+            fields[fieldCount++] = line;
 
-        // Copy GitHub workflows: Windows, Linux, macOS, Webassembly
-        FileCopy(TextFormat("%s/.github/workflows/build_windows.yml", templatePath),
-            TextFormat("%s/%s/.github/workflows/build_windows.yml", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
-        FileCopy(TextFormat("%s/.github/workflows/build_linux.yml", templatePath),
-            TextFormat("%s/%s/.github/workflows/build_linux.yml", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
-        FileCopy(TextFormat("%s/.github/workflows/build_macos.yml", templatePath),
-            TextFormat("%s/%s/.github/workflows/build_macos.yml", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
-        FileCopy(TextFormat("%s/.github/workflows/build_webassembly.yml", templatePath),
-            TextFormat("%s/%s/.github/workflows/build_webassembly.yml", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
+            for (char *ptr = line; (*ptr != '\0') && (fieldCount < 8); ptr++)
+            {
+                if ((*ptr == '\r') || (*ptr == '\t'))
+                {
+                    bool separator = (*ptr == '\t');
+                    *ptr = '\0';
+                    if (separator) fields[fieldCount++] = ptr + 1;
+                }
+            }
+
+            if (fieldCount == 8)
+            {
+                GenManifestEntry *entry = &manifest.entries[manifest.count];
+
+                entry->type = (int)strtol(fields[0], NULL, 10);
+                entry->hash = strtoull(fields[1], NULL, 16);
+                entry->srcSize = (int)strtol(fields[2], NULL, 10);
+                entry->srcModTime = strtol(fields[3], NULL, 10);
+                entry->outSize = (int)strtol(fields[4], NULL, 10);
+                entry->outModTime = strtol(fields[5], NULL, 10);
+                entry->outPath = TextCopyAlloc(fields[6]);
+                entry->srcPath = TextCopyAlloc(fields[7]);
+
+                manifest.count++;
+            }
+        }
 
-        LOG("INFO: Build system generated successfully: GitHub Actions (CI/CD workflows)\n");
+        line = (lineEnd != NULL)? lineEnd + 1 : NULL;
     }
-    //-------------------------------------------------------------------------------------
 
-    // Update additional files required for product building
-    //  - src/project_name.rc   -> Windows: Executable resource file, includes .ico and metadata
-    //  - src/project_name.ico  -> Product icon, required for Window resource file
-    //  - src/project_name.icns -> macOS: Product icon, required by Info.plist
-    //  - src/Info.plist        -> macOS application resource file, includes .icns and metadata
-    //  - src/minshell.html     -> Web: Html minimum shell for WebAssembly application, preconfigured
-    //-------------------------------------------------------------------------------------
-    LOG("INFO: Generating additional files\n");
-    // Update src/project_name.rc
-    fileText = LoadFileText(TextFormat("%s/src/project_name.rc", templatePath));
-    // TODO: Replace "project_name.ico" by GetFileName(rpcGetText(project, "PROJECT_ICON_FILE")) if possible
-    fileTextUpdated[0] = TextReplaceAlloc(fileText, "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME"));
-    fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-    fileTextUpdated[2] = TextReplaceAlloc(fileTextUpdated[1], "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION"));
-    fileTextUpdated[3] = TextReplaceAlloc(fileTextUpdated[2], "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME"));
-    fileTextUpdated[4] = TextReplaceAlloc(fileTextUpdated[3], "ProjectYear", TextFormat("%i", currentYear));
-    SaveFileText(TextFormat("%s/%s/%s/%s.rc", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH"), rpcGetText(project, "PROJECT_INTERNAL_NAME")), fileTextUpdated[4]);
-    for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
     UnloadFileText(fileText);
-    LOG("INFO: Generated Windows resource file successfully: %s/%s.rc\n", rpcGetText(project, "PROJECT_SOURCE_PATH"), rpcGetText(project, "PROJECT_INTERNAL_NAME"));
 
-    // Copy src/project_name.rc.data
-    // TODO: It should be generated but ok for now
-    FileCopy(TextFormat("%s/src/project_name.rc.data", templatePath),
-        TextFormat("%s/%s/%s/%s.rc.data", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH"), rpcGetText(project, "PROJECT_INTERNAL_NAME")));
+    // Build entries lookup table by output path
+    // NOTE: Open addressing with linear probing, table kept at most half full
+    manifest.lookupSize = 64;
+    while (manifest.lookupSize < manifest.count*2) manifest.lookupSize *= 2;
 
-    // Copy src/project_name.ico to src/project_name.ico
-    // TODO: Generate .ico file from .png if required?
-    if (FileExists(rpcGetText(project, "PROJECT_ICON_FILE")))
-    {
-        const char *iconFilePath = TextFormat("%s/%s/%s/%s", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH"), GetFileName(rpcGetText(project, "PROJECT_ICON_FILE")));
-        FileCopy(rpcGetText(project, "PROJECT_ICON_FILE"), TextReplace(iconFilePath, "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME")));
-        LOG("INFO: Added icon file successfully: %s\n", TextReplace(iconFilePath, "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME")));
-    }
-    else
-    {
-        FileCopy(TextFormat("%s/src/project_name.ico", templatePath),
-            TextFormat("%s/%s/%s/%s.ico", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH"), rpcGetText(project, "PROJECT_INTERNAL_NAME")));
-        LOG("INFO: Added icon file successfully: %s/%s.ico\n", rpcGetText(project, "PROJECT_SOURCE_PATH"), rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-    }
+    manifest.lookup = (int *)RL_MALLOC(manifest.lookupSize*sizeof(int));
+    for (int i = 0; i < manifest.lookupSize; i++) manifest.lookup[i] = -1;
 
-    // Copy src/project_name.icns to src/project_name.icns
-    // TODO: Generate .icns from input .ico/.png
-    FileCopy(TextFormat("%s/src/project_name.icns", templatePath),
-        TextFormat("%s/%s/%s/%s.icns", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH"), rpcGetText(project, "PROJECT_INTERNAL_NAME")));
-    LOG("INFO: Added icon file (.icns) successfully (macOS)\n");
+    for (int i = 0; i < manifest.count; i++)
+    {
+        unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)manifest.entries[i].outPath,
+            (int)strlen(manifest.entries[i].outPath)) & (manifest.lookupSize - 1);
 
-    // Update src/Info.plist
-    fileText = LoadFileText(TextFormat("%s/src/Info.plist", templatePath));
-    fileTextUpdated[0] = TextReplaceAlloc(fileText, "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME"));
-    fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-    fileTextUpdated[2] = TextReplaceAlloc(fileTextUpdated[1], "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION"));
-    fileTextUpdated[3] = TextReplaceAlloc(fileTextUpdated[2], "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME"));
-    fileTextUpdated[4] = TextReplaceAlloc(fileTextUpdated[3], "project_developer", TextToSnake(rpcGetText(project, "PROJECT_PUBLISHER_NAME")));
-    fileTextUpdated[5] = TextReplaceAlloc(fileTextUpdated[4], "ProjectYear", TextFormat("%i", currentYear));
-    SaveFileText(TextFormat("%s/%s/%s/Info.plist", outPath, rpcGetText(project, "PROJECT_REPO_NAME"), rpcGetText(project, "PROJECT_SOURCE_PATH")), fileTextUpdated[5]);
-    for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-    UnloadFileText(fileText);
-    LOG("INFO: Generated Info.plist successfully (macOS)\n");
+        while (manifest.lookup[slot] != -1) slot = (slot + 1) & (manifest.lookupSize - 1);
+        manifest.lookup[slot] = i;
+    }
 
-    // Update src/minshell.html
-    // Review Webpage, links, OpenGraph/X card, keywords...
-    fileText = LoadFileText(TextFormat("%s/src/minshell.html", templatePath));
-    fileTextUpdated[0] = TextReplaceAlloc(fileText, "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME"));
-    fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-    fileTextUpdated[2] = TextReplaceAlloc(fileTextUpdated[1], "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION"));
-    fileTextUpdated[3] = TextReplaceAlloc(fileTextUpdated[2], "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME"));
-    fileTextUpdated[4] = TextReplaceAlloc(fileTextUpdated[3], "project_developer", TextToLower(rpcGetText(project, "PROJECT_DEVELOPER_NAME")));
-    fileTextUpdated[5] = TextReplaceAlloc(fileTextUpdated[4], "ProjectDeveloperUrl", TextToLower(rpcGetText(project, "PROJECT_DEVELOPER_URL")));
-    SaveFileText(TextFormat("%s/%s/src/minshell.html", outPath, rpcGetText(project, "PROJECT_REPO_NAME")), fileTextUpdated[5]);
-    for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-    UnloadFileText(fileText);
-    LOG("INFO: Generated minshell.html successfully (WebAssembly)\n");
-    //-------------------------------------------------------------------------------------
+    return manifest;
+}
 
-    // Update README.md
-    fileText = LoadFileText(TextFormat("%s/README.md", templatePath));
-    fileTextUpdated[0] = TextReplaceAlloc(fileText, "CommercialName", rpcGetText(project, "PROJECT_COMMERCIAL_NAME"));
-    fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "project_name", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-    fileTextUpdated[2] = TextReplaceAlloc(fileTextUpdated[1], "ProjectDescription", rpcGetText(project, "PROJECT_DESCRIPTION"));
-    fileTextUpdated[3] = TextReplaceAlloc(fileTextUpdated[2], "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME"));
-    fileTextUpdated[4] = TextReplaceAlloc(fileTextUpdated[3], "ProjectYear", TextFormat("%i", currentYear));
-    SaveFileText(TextFormat("%s/%s/README.md", outPath, rpcGetText(project, "PROJECT_REPO_NAME")), fileTextUpdated[4]);
-    for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-    UnloadFileText(fileText);
-    LOG("INFO: Generated README.md file successfully\n");
+// Unload generation manifest data
+static void UnloadGenManifest(GenManifest *manifest)
+{
+    for (int i = 0; i < manifest->count; i++)
+    {
+        RL_FREE(manifest->entries[i].outPath);
+        RL_FREE(manifest->entries[i].srcPath);
+    }
 
-    // Update LICENSE, including ProjectDeveloper
-    fileText = LoadFileText(TextFormat("%s/LICENSE", templatePath));
-    fileTextUpdated[0] = TextReplaceAlloc(fileText, "ProjectDeveloper", rpcGetText(project, "PROJECT_DEVELOPER_NAME"));
-    fileTextUpdated[1] = TextReplaceAlloc(fileTextUpdated[0], "ProjectYear", TextFormat("%i", currentYear));
-    SaveFileText(TextFormat("%s/%s/LICENSE", outPath, rpcGetText(project, "PROJECT_REPO_NAME")), fileTextUpdated[1]);
-    for (int i = 0; i < 8; i++) { MemFree(fileTextUpdated[i]); fileTextUpdated[i] = NULL; }
-    UnloadFileText(fileText);
-    LOG("INFO: Generated LICENSE file successfully: zlib/libpng\n");
+    RL_FREE(manifest->entries);
+    RL_FREE(manifest->lookup);
 
-    // Copy from template files that do not require customization: CONVENTIONS.md, .gitignore
-    FileCopy(TextFormat("%s/CONVENTIONS.md", templatePath),
-        TextFormat("%s/%s/CONVENTIONS.md", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
-    LOG("INFO: Generated CONVENTIONS.md file successfully\n");
-    FileCopy(TextFormat("%s/.gitignore", templatePath),
-        TextFormat("%s/%s/.gitignore", outPath, rpcGetText(project, "PROJECT_REPO_NAME")));
-    LOG("INFO: Generated .gitignore file successfully\n\n");
-
-    LOG("INFO: Project generated successfully: %s\n", rpcGetText(project, "PROJECT_INTERNAL_NAME"));
-    LOG("-----------------------------------------------------------------\n");
+    memset(manifest, 0, sizeof(GenManifest));
 }
 
-// Packing of directory files into a binary blob
-static char *PackDirectoryData(const char *baseDirPath, int *packSize)
+// Get manifest entry for output path (relative to project output directory)
+static const GenManifestEntry *GetGenManifestEntry(const GenManifest *manifest, const char *outPath)
 {
-    #define MAX_PACKED_DATA_SIZE    10*1024*1024    // 10 MB
+    if (manifest->count == 0) return NULL;
 
-    int fullPackSize = 0;
-    char *data = NULL;
-
-    FilePathList files = LoadDirectoryFilesEx(baseDirPath, NULL, true);
+    unsigned int slot = (unsigned int)ComputeHashFNV64((const unsigned char *)outPath, (int)strlen(outPath)) & (manifest->lookupSize - 1);
 
-    if (files.count > 0)
+    while (manifest->lookup[slot] != -1)
     {
-        int filesDataSize = 0;
-        data = (char *)RL_CALLOC(MAX_PACKED_DATA_SIZE, 1);
-        PackFileEntry *entries = (PackFileEntry *)RL_CALLOC(files.count, sizeof(PackFileEntry));
-
-        for (unsigned int i = 0; i < files.count; i++)
-        {
-            strcpy(entries[i].filePath, files.paths[i]);
-            unsigned char *fileData = LoadFileData(files.paths[i], &entries[i].fileSize);
-            unsigned char *compFileData = CompressData(fileData, entries[i].fileSize, &entries[i].compFileSize);
-            UnloadFileData(fileData);
+        const GenManifestEntry *entry = &manifest->entries[manifest->lookup[slot]];
+        if (strcmp(entry->outPath, outPath) == 0) return entry;
 
-            printf("Packing file: %s\n", files.paths[i]);
-
-            memcpy(data + filesDataSize, compFileData, entries[i].compFileSize);
-            filesDataSize += entries[i].compFileSize;
-            MemFree(compFileData);
-        }
-
-        // OPTION: Compress entries data for optimization
-        int compEntriesDataSize = 0;
-        unsigned char *compEntriesData = CompressData((unsigned char *)entries, files.count*sizeof(PackFileEntry), &compEntriesDataSize);
+        slot = (slot + 1) & (manifest->lookupSize - 1);
+    }
 
-        // Append entries data + compEntriesDataSize + filesDataSize + files.count + CCFOUR (at the end of file)
-        fullPackSize = filesDataSize;
-        memcpy(data + fullPackSize, compEntriesData, compEntriesDataSize);
-        fullPackSize += compEntriesDataSize;
+    return NULL;
+}
 
-        memcpy(data + fullPackSize, &compEntriesDataSize, sizeof(int));
-        fullPackSize += sizeof(int);
-        memcpy(data + fullPackSize, &filesDataSize, sizeof(int));
-        fullPackSize += sizeof(int);
-        memcpy(data + fullPackSize, &files.count, sizeof(int));
-        fullPackSize += sizeof(int);
-        char fourcc[5] = "rpch";
-        memcpy(data + fullPackSize, fourcc, 4);
-        fullPackSize += 4;
-    }
+// Get job output path relative to project output directory (base path)
+// NOTE: Returns NULL if output path is not inside base path
+static const char *GetGenRelativePath(const char *outPath, const char *basePath)
+{
+    int basePathLength = (int)strlen(basePath);
 
-    UnloadDirectoryFiles(files);
+    if ((outPath == NULL) || (strncmp(outPath, basePath, basePathLength) != 0) || (outPath[basePathLength] != '/')) return NULL;
 
-    *packSize = fullPackSize;
-    return data;
+    return outPath + basePathLength + 1;
 }
 
-// Unpacking of directory files from a binary blob
-static void UnpackDirectoryData(const char *outputDirPath, const unsigned char *data, int *dataSize, PackFileEntry *entries, int fileCount)
+// Link jobs to previous manifest entries for same output path
+static void SetGenJobsManifest(GenJobList *list, const GenManifest *manifest, const char *basePath)
 {
-    int nextFileDataOffset = 0;
-
-    for (int i = 0; i < fileCount; i++)
+    for (int i = 0; i < list->count; i++)
     {
-        // Decompress entry from data
-        int fileDataSize = 0;
-        unsigned char *fileData = DecompressData(data + nextFileDataOffset, entries[i].compFileSize, &fileDataSize);
+        GenJob *job = &list->jobs[i];
 
-        // Verify process worked as expected
-        if ((fileData != NULL) && (fileDataSize == entries[i].fileSize))
-        {
-            SaveFileData(TextFormat("%s/%s", outputDirPath, entries[i].filePath), fileData, fileDataSize);
-        }
-        else
+        if (job->type >= GEN_JOB_COPY)
         {
-            LOG("WARNING: File data could not be decompressed!\n");
-            break;
+            const char *relativePath = GetGenRelativePath(job->dstPath, basePath);
+            job->prevEntry = (relativePath != NULL)? GetGenManifestEntry(manifest, relativePath) : NULL;
         }
-
-        MemFree(fileData);
-        nextFileDataOffset += entries[i].compFileSize;
     }
 }
 
-// Load a text file data from memory packed data
-static char *LoadFileTextPack(const char *fileName, const unsigned char *packData, PackFileEntry *entries, int fileCount)
+// Save generation manifest from processed jobs
+static void SaveGenManifest(const GenJobList *list, const char *basePath, const char *fileName)
 {
-    int fileDataSize = 0;
-    char *fileData = NULL;
+    FILE *file = fopen(fileName, "wt");
 
-    // Find data offset in package and decompress it
-    for (int i = 0, dataOffset = 0; i < fileCount; i++)
+    if (file != NULL)
     {
-        if (TextIsEqual(fileName, entries[i].filePath))
+        fprintf(file, "# rpc generation manifest, used for incremental project generation\n");
+        fprintf(file, "# type\thash\tsrcSize\tsrcModTime\toutSize\toutModTime\toutPath\tsrcPath\n");
+
+        for (int i = 0; i < list->count; i++)
         {
-            unsigned char *uncompFileData = DecompressData(packData + dataOffset, entries[i].compFileSize, &fileDataSize);
+            const GenJob *job = &list->jobs[i];
+            const char *relativePath = GetGenRelativePath(job->dstPath, basePath);
+
+            if ((relativePath == NULL) || (job->type < GEN_JOB_COPY)) continue;
 
-            if ((fileData != NULL) && (fileDataSize == entries[i].fileSize))
+            if (!job->failed)
             {
-                // NOTE: We make sure the text data ends with /0
-                fileData = (char *)RL_CALLOC(entries[i].fileSize + 1, 1);
-                memcpy(fileData, uncompFileData, fileDataSize);
-                MemFree(uncompFileData);
+                fprintf(file, "%i\t%016llx\t%i\t%li\t%i\t%li\t%s\t%s\n", job->type, job->hash,
+                    job->srcSize, job->srcModTime, job->outSize, job->outModTime, relativePath, job->srcPath);
+            }
+            else if (job->prevEntry != NULL)
+            {
+                // NOTE: Failed outputs keep previous generation entry, output is still tracked
+                // to be generated again (if changed) or removed when not generated anymore
+                const GenManifestEntry *prev = job->prevEntry;
+                fprintf(file, "%i\t%016llx\t%i\t%li\t%i\t%li\t%s\t%s\n", prev->type, prev->hash,
+                    prev->srcSize, prev->srcModTime, prev->outSize, prev->outModTime, prev->outPath, prev->srcPath);
             }
-            else LOG("WARNING: File not loaded properly from pack\n");
-
-            break;
         }
-        else dataOffset += entries[i].compFileSize;
-    }
 
-    return fileData;
+        fclose(file);
+    }
+    else LOG("WARNING: Generation manifest file could not be saved: %s\n", fileName);
 }
 
-// Split string into multiple strings
-// NOTE: No memory is dynamically allocated
-static const char **GetSubtextPtrs(char *text, char delimiter, int *count)
+// Remove previous outputs not generated anymore, returns removed files count
+// NOTE 1: Only outputs not modified after previous generation (or still linked to source) are removed
+// NOTE 2: Directories left empty are removed up to project output directory (base path),
+// directories created by current generation are kept
+static int RemoveGenStaleOutputs(const GenManifest *manifest, const GenJobList *dirList, const GenJobList *list, const char *basePath)
 {
-    #define MAX_SUBTEXTPTRS_COUNT    1024
+    int removedCount = 0;
+    int basePathLength = (int)strlen(basePath);
 
-    // WARNING: Input string is modified, '\0' is added in the delimiter and the resulting strings
-    // are returned as a static array of pointers
-    // Maximum number of pointed strings is set by MAX_TEXTSPLIT_COUNT
-    static const char *result[MAX_SUBTEXTPTRS_COUNT] = { NULL };
+    // Mark previous entries generated again
+    bool *generated = (bool *)RL_CALLOC(manifest->count + 1, sizeof(bool));
 
-    result[0] = text;
-    int counter = 1;
-    int textLength = TextLength(text);
+    for (int i = 0; i < list->count; i++)
+    {
+        if (list->jobs[i].prevEntry != NULL) generated[list->jobs[i].prevEntry - manifest->entries] = true;
+    }
 
-    if (text != NULL)
+    for (int i = 0; i < manifest->count; i++)
     {
-        // Count how many substrings we have on text and point to every one
-        for (int i = 0; i < textLength; i++)
+        if (!generated[i])
         {
-            if (text[i] == '\0') break;
-            else if (text[i] == delimiter)
+            char outPath[RPC_MAX_PATH_LENGTH] = { 0 };
+            snprintf(outPath, RPC_MAX_PATH_LENGTH, "%s/%s", basePath, manifest->entries[i].outPath);
+
+            const GenManifestEntry *entry = &manifest->entries[i];
+
+            // NOTE: Output being the source file itself is never removed
+            if (IsSameFilePath(entry->srcPath, outPath)) continue;
+
+            bool linked = (entry->type >= GEN_JOB_LINK) && (IsFileLinked(entry->srcPath, outPath, false) || IsFileLinked(entry->srcPath, outPath, true));
+
+            if ((linked || IsGenOutputUnchanged(entry, outPath)) && (remove(outPath) == 0))
             {
-                text[i] = '\0';   // Set an end of string at this point
-                result[counter] = text + i + 1;
-                counter++;
+                LOG("INFO: Removed stale output file: %s\n", outPath);
+                removedCount++;
 
-                if (counter == MAX_SUBTEXTPTRS_COUNT) break;
+                // Remove parent directories left empty, from deepest one
+                for (int c = (int)strlen(outPath) - 1; c > basePathLength; c--)
+                {
+                    if (outPath[c] != '/') continue;
+                    outPath[c] = '\0';
+
+                    bool planned = false;
+                    for (int d = 0; (d < dirList->count) && !planned; d++) planned = (strcmp(dirList->jobs[d].dstPath, outPath) == 0);
+
+                    if (planned || !RemoveDirectoryEntry(outPath)) break;
+                    LOG("INFO: Removed empty output directory: %s\n", outPath);
+                }
             }
         }
     }
 
-    *count = counter;
-    return result;
+    RL_FREE(generated);
+
+    return removedCount;
 }
 
 // Load/Save application configuration functions